@@ -116,11 +116,19 @@ int main()
 	cv::createTrackbar("Min Width-Distance Ratio (%) (Small Armor)", "Armors Control", &MinWidthDistanceRatioSmallArmor, 100);
 	cv::createTrackbar("Max Width-Distance Ratio (%) (Small Armor)", "Armors Control", &MaxWidthDistanceRatioSmallArmor, 300);
 
+	// 每帧的图像尺寸相同，在循环外声明的图像将复用上一帧的内存
+	cv::Mat bgr_picture;
+	cv::Mat hsv_picture;
+	cv::Mat channels[3];
+	cv::Mat mask[6];
+	cv::Mat result;
+	cv::Mat min_mask, max_mask;
+	cv::Mat light_bars_result_picture;
+	cv::Mat armors_result_picture;
+
 	while(cv::waitKey(1) != 27)
 	{
-		auto bgr_picture = acquisitor.GetPicture(true);
-
-		cv::resize(bgr_picture, bgr_picture, cv::Size(1024, 768));
+		cv::resize(acquisitor.GetPicture(true), bgr_picture, cv::Size(1024, 768));
 
 		//------------------------------
 		// 原始图像预处理
@@ -134,13 +142,10 @@ int main()
 		// 颜色过滤
 		//------------------------------
 
-		cv::Mat hsv_picture;
 		cv::cvtColor(bgr_picture, hsv_picture, cv::COLOR_BGR2HSV);
 
-		cv::Mat channels[3];
 		cv::split(hsv_picture, channels);
 
-		cv::Mat mask[6];
 		cv::threshold(channels[0], mask[0], MinHue, 255, cv::THRESH_BINARY);
 		cv::threshold(channels[0], mask[1], MaxHue, 255, cv::THRESH_BINARY_INV);
 
@@ -150,8 +155,6 @@ int main()
 		cv::threshold(channels[2], mask[4], MinValue, 255, cv::THRESH_BINARY);
 		cv::threshold(channels[2], mask[5], MaxValue, 255, cv::THRESH_BINARY_INV);
 
-		cv::Mat result;
-		cv::Mat min_mask, max_mask;
 		cv::bitwise_and(mask[0], mask[2], min_mask, mask[4]);
 		cv::bitwise_and(mask[1], mask[3], max_mask, mask[5]);
 		cv::bitwise_and(min_mask, max_mask, result);
@@ -184,10 +187,9 @@ int main()
 			}
 		}
 
-		cv::Mat background_picture(result.size(), CV_8UC3, cv::Scalar(0,0,0));
-		cv::Mat foreground_picture(result.size(), CV_8UC3, cv::Scalar(255,255,255));
-		cv::Mat light_bars_result_picture = background_picture;
-		foreground_picture.copyTo(light_bars_result_picture, result);
+		light_bars_result_picture.create(result.size(), CV_8UC3);
+		light_bars_result_picture.setTo(cv::Scalar(0,0,0));
+		light_bars_result_picture.setTo(cv::Scalar(255,255,255), result);
 
 		if (!filtered_contours.empty())
 			cv::drawContours(light_bars_result_picture, filtered_contours, -1, cv::Scalar(0, 255, 255), cv::FILLED);
@@ -284,8 +286,7 @@ int main()
 			}
 		}
 
-		cv::Mat armors_result_picture(bgr_picture.size(), CV_8UC3);
-		armors_result_picture = bgr_picture.clone();
+		bgr_picture.copyTo(armors_result_picture);
 
 		for (auto& armor : matched_armors)
 		{
@@ -0,0 +1,128 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <tbb/concurrent_unordered_set.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+/// 工作流等待区的暂停与恢复基准测试
+
+using namespace Galaxy;
+
+/// 唤醒对端工作流的流处理器
+class PingProcessor AsProcessor
+{
+	NoRequirement;
+public:
+	/// 对端工作流
+	Core::AbstractWorkflow* Peer {nullptr};
+
+	Process
+	{
+		Runtime::GetInstance()->WorkflowWaitingZone.Awake(Peer);
+	}
+};
+
+/// 唤醒对端后进入等待的工作流
+class PingPongFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Procedure:
+	PingProcessor Ping On(Main);
+	BuiltIn::WaitAction Wait On(Main);
+};
+
+/// 两个工作流在不同执行器上互相唤醒，测量往返耗时
+void BenchmarkPingPong(int rounds)
+{
+	SerialExecutor first_executor, second_executor;
+	first_executor.Start();
+	second_executor.Start();
+
+	PingPongFlow first, second;
+	first.Main = &first_executor;
+	second.Main = &second_executor;
+	first.Ping.Peer = &second;
+	second.Ping.Peer = &first;
+	first.Loop = second.Loop = true;
+
+	std::atomic_int first_ends {0}, second_ends {0};
+	first.OnEnd = [&]{ ++first_ends; };
+	second.OnEnd = [&]{ ++second_ends; };
+	first.LoopStopCondition = [&]{ return first_ends >= rounds; };
+	second.LoopStopCondition = [&]{ return second_ends >= rounds; };
+
+	auto begin = std::chrono::steady_clock::now();
+	first_executor.Submit(&first);
+	second_executor.Submit(&second);
+	while (first_ends < rounds && second_ends < rounds)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+
+	// 先结束的工作流不再唤醒对端，对端的最后一次等待需要由此处结束
+	while (first_ends < rounds || second_ends < rounds)
+	{
+		Runtime::GetInstance()->WorkflowWaitingZone.Awake(&first);
+		Runtime::GetInstance()->WorkflowWaitingZone.Awake(&second);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	first_executor.Stop();
+	second_executor.Stop();
+	first_executor.Join();
+	second_executor.Join();
+
+	std::cout << "Ping-pong through Wait/Awake: " << elapsed.count() / rounds << " ns per round trip" << std::endl;
+}
+
+/// 比较状态字与并发哈希集合完成一次等待和唤醒的记录开销
+void BenchmarkBookkeeping(int iterations)
+{
+	// 状态字：进入等待与唤醒各一次比较交换
+	std::atomic<std::uint64_t> state_word {0};
+	auto state_word_begin = std::chrono::steady_clock::now();
+	for (int index = 0; index < iterations; ++index)
+	{
+		auto current = state_word.load();
+		state_word.compare_exchange_strong(current, (current & ~3ull) | 1);
+		current = state_word.load();
+		state_word.compare_exchange_strong(current, ((current >> 2) + 1) << 2);
+	}
+	auto state_word_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - state_word_begin);
+
+	// 并发哈希集合：原等待区的查找、插入与删除
+	tbb::concurrent_unordered_set<void*> waiting_set, awaken_set;
+	void* workflow = &state_word;
+	auto set_begin = std::chrono::steady_clock::now();
+	for (int index = 0; index < iterations; ++index)
+	{
+		if (awaken_set.find(workflow) == awaken_set.end())
+		{
+			waiting_set.insert(workflow);
+		}
+		auto finder = waiting_set.find(workflow);
+		if (finder != waiting_set.end())
+		{
+			waiting_set.unsafe_erase(finder);
+		}
+	}
+	auto set_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - set_begin);
+
+	std::cout << "Wait+awake bookkeeping: state word "
+		<< static_cast<double>(state_word_elapsed.count()) / iterations << " ns, tbb set "
+		<< static_cast<double>(set_elapsed.count()) / iterations << " ns" << std::endl;
+}
+
+int main()
+{
+	BenchmarkPingPong(200000);
+	BenchmarkBookkeeping(5000000);
+	return 0;
+}
@@ -0,0 +1,44 @@
+#include "ConditionAwaitable.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/// 订阅条件成立事件
+	void ConditionAwaitable::Subscribe(std::function<void()> resume)
+	{
+		{
+			std::unique_lock lock(WaitersMutex);
+			Waiters.push_back(std::move(resume));
+			WaitersCount.store(Waiters.size());
+		}
+
+		// 通知可能发生在首次检查条件和登记等待者之间，故需要重新检查
+		if (Condition())
+		{
+			TryResume();
+		}
+	}
+
+	/// 通知
+	void ConditionAwaitable::Notify()
+	{
+		TryResume();
+	}
+
+	/// 认领并恢复等待者
+	void ConditionAwaitable::TryResume()
+	{
+		if (WaitersCount.load() == 0) return;
+
+		// 恢复后等待者可能立即再次订阅，故先在锁内取出恢复函数器，再在锁外调用
+		std::vector<std::function<void()>> waiters;
+		{
+			std::unique_lock lock(WaitersMutex);
+			waiters.swap(Waiters);
+			WaitersCount.store(0);
+		}
+		for (auto& resume : waiters)
+		{
+			resume();
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../Core/AbstractAwaitable.hpp"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 条件可等待对象
+	 * @author Vincent
+	 * @details
+	 *  ~ 条件函数器返回true时视为就绪；否则等待者将被挂起，直至生产者使条件成立后调用Notify方法。
+	 *  ~ 条件本身是唯一的判据，没有等待者时的通知将被丢弃，不会累积；
+	 *    订阅后会重新检查条件，故生产者先使条件成立再通知即不会错过唤醒。
+	 *  ~ 允许多个流处理器同时等待同一对象，通知将恢复所有等待者。
+	 *  ~ 适用于等待新的相机帧、GPU流完成或其他线程设置的旗标，Notify方法可以在任意线程中调用，包括驱动的回调线程。
+	 */
+	class ConditionAwaitable : public Core::AbstractAwaitable
+	{
+	private:
+		/// 等待者的数量，用于在没有等待者时跳过加锁
+		std::atomic_size_t WaitersCount {0};
+		/// 等待者列表互斥量
+		std::mutex WaitersMutex;
+		/// 等待者的恢复函数器
+		std::vector<std::function<void()>> Waiters {};
+
+		/// 若存在等待者，则认领并恢复所有等待者
+		void TryResume();
+
+	public:
+		/**
+		 * @brief 条件函数器
+		 * @details
+		 *  ~ 可能在等待者和通知者的线程中同时调用，应当是线程安全的。
+		 */
+		std::function<bool()> Condition;
+
+		/**
+		 * @brief 构造函数
+		 * @param condition 条件函数器
+		 */
+		explicit ConditionAwaitable(std::function<bool()> condition) : Condition(std::move(condition))
+		{}
+
+		/// 查询条件是否成立
+		[[nodiscard]] bool IsReady() override
+		{
+			return Condition();
+		}
+
+		/// 订阅条件成立事件
+		void Subscribe(std::function<void()> resume) override;
+
+		/**
+		 * @brief 通知条件可能已经成立
+		 * @details
+		 *  ~ 应当在使条件成立之后调用；若存在等待者，则将其全部恢复。
+		 */
+		void Notify();
+	};
+}
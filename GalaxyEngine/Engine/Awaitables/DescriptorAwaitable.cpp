@@ -0,0 +1,28 @@
+#include "DescriptorAwaitable.hpp"
+#include "../Executors/TimerExecutor.hpp"
+
+#include <stdexcept>
+#include <poll.h>
+
+namespace Galaxy::BuiltIn
+{
+	/// 查询文件描述符是否已经就绪
+	bool DescriptorAwaitable::IsReady()
+	{
+		pollfd target {};
+		target.fd = Descriptor;
+		target.events = Writable ? POLLOUT : POLLIN;
+		// 出错或挂断时同样视为就绪，由调用者在读写时处理错误
+		return poll(&target, 1, 0) > 0 && target.revents != 0;
+	}
+
+	/// 订阅就绪事件
+	void DescriptorAwaitable::Subscribe(std::function<void()> resume)
+	{
+		if (!Watcher)
+		{
+			throw std::runtime_error("[DescriptorAwaitable::Subscribe] Watcher Executor is Null.");
+		}
+		Watcher->WatchDescriptor(Descriptor, Writable, std::move(resume));
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Core/AbstractAwaitable.hpp"
+
+namespace Galaxy
+{
+	/// 计时执行器
+	class TimerExecutor;
+}
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 文件描述符可等待对象
+	 * @author Vincent
+	 * @details
+	 *  ~ 文件描述符可读或可写时就绪，适用于串口、套接字等设备；等待期间由计时执行器的epoll监视，不占用任何执行器线程。
+	 *  ~ 同一文件描述符同一时刻只能被一个对象等待。
+	 */
+	class DescriptorAwaitable : public Core::AbstractAwaitable
+	{
+	public:
+		/// 负责监视的计时执行器
+		TimerExecutor* Watcher;
+		/// 文件描述符
+		int Descriptor {-1};
+		/// 为true时等待可写，否则等待可读
+		bool Writable {false};
+
+		/**
+		 * @brief 构造函数
+		 * @param watcher 负责监视的计时执行器
+		 */
+		explicit DescriptorAwaitable(TimerExecutor* watcher = nullptr) : Watcher(watcher)
+		{}
+
+		/**
+		 * @brief 等待可读
+		 * @param descriptor 文件描述符
+		 * @return 自身
+		 */
+		DescriptorAwaitable& ForReading(int descriptor)
+		{
+			Descriptor = descriptor;
+			Writable = false;
+			return *this;
+		}
+
+		/**
+		 * @brief 等待可写
+		 * @param descriptor 文件描述符
+		 * @return 自身
+		 */
+		DescriptorAwaitable& ForWriting(int descriptor)
+		{
+			Descriptor = descriptor;
+			Writable = true;
+			return *this;
+		}
+
+		/// 以非阻塞的方式查询文件描述符是否已经就绪
+		[[nodiscard]] bool IsReady() override;
+
+		/**
+		 * @brief 订阅就绪事件
+		 * @throw std::runtime_error 当未指定计时执行器，或无法监视该文件描述符
+		 */
+		void Subscribe(std::function<void()> resume) override;
+	};
+}
@@ -0,0 +1,17 @@
+#include "TimerAwaitable.hpp"
+#include "../Executors/TimerExecutor.hpp"
+
+#include <stdexcept>
+
+namespace Galaxy::BuiltIn
+{
+	/// 订阅到期事件
+	void TimerAwaitable::Subscribe(std::function<void()> resume)
+	{
+		if (!Timer)
+		{
+			throw std::runtime_error("[TimerAwaitable::Subscribe] Timer Executor is Null.");
+		}
+		Timer->ScheduleCallback(DueTime, std::move(resume));
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Core/AbstractAwaitable.hpp"
+
+#include <chrono>
+
+namespace Galaxy
+{
+	/// 计时执行器
+	class TimerExecutor;
+}
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 计时可等待对象
+	 * @author Vincent
+	 * @details
+	 *  ~ 到达到期时间后就绪；等待期间由计时执行器的时间轮计时，不占用任何执行器线程。
+	 */
+	class TimerAwaitable : public Core::AbstractAwaitable
+	{
+	public:
+		/// 负责计时的计时执行器
+		TimerExecutor* Timer;
+		/// 到期时间
+		std::chrono::steady_clock::time_point DueTime {};
+
+		/**
+		 * @brief 构造函数
+		 * @param timer 负责计时的计时执行器
+		 */
+		explicit TimerAwaitable(TimerExecutor* timer = nullptr) : Timer(timer)
+		{}
+
+		/**
+		 * @brief 设置到期时间
+		 * @param due_time 到期时间
+		 * @return 自身
+		 */
+		TimerAwaitable& Until(std::chrono::steady_clock::time_point due_time)
+		{
+			DueTime = due_time;
+			return *this;
+		}
+
+		/**
+		 * @brief 设置等待时长
+		 * @param duration 自当前时刻起的等待时长
+		 * @return 自身
+		 */
+		TimerAwaitable& For(std::chrono::steady_clock::duration duration)
+		{
+			DueTime = std::chrono::steady_clock::now() + duration;
+			return *this;
+		}
+
+		/// 查询是否已经到期
+		[[nodiscard]] bool IsReady() override
+		{
+			return std::chrono::steady_clock::now() >= DueTime;
+		}
+
+		/**
+		 * @brief 订阅到期事件
+		 * @throw std::runtime_error 当未指定计时执行器
+		 */
+		void Subscribe(std::function<void()> resume) override;
+	};
+}
@@ -0,0 +1,278 @@
+#include "CPUTopology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+namespace Galaxy
+{
+	/**
+	 * @brief 读取文本文件的第一行
+	 * @param path 文件路径
+	 * @return 可选，文件不存在或无法读取时返回std::nullopt
+	 */
+	std::optional<std::string> ReadFirstLine(const std::string& path)
+	{
+		std::ifstream file(path);
+		std::string line;
+		if (!file || !std::getline(file, line))
+		{
+			return std::nullopt;
+		}
+		return line;
+	}
+
+	/**
+	 * @brief 读取文本文件中的整数
+	 * @param path 文件路径
+	 * @return 可选，文件不存在或内容不是整数时返回std::nullopt
+	 */
+	std::optional<long long> ReadInteger(const std::string& path)
+	{
+		auto line = ReadFirstLine(path);
+		if (!line) return std::nullopt;
+		try
+		{
+			return std::stoll(*line);
+		}
+		catch (std::exception&)
+		{
+			return std::nullopt;
+		}
+	}
+
+	/**
+	 * @brief 解析处理器列表
+	 * @param text 形如"0-3,5"的处理器列表文本
+	 * @return 处理器编号列表
+	 */
+	std::vector<unsigned int> ParseProcessorList(const std::string& text)
+	{
+		std::vector<unsigned int> processors;
+		std::stringstream stream(text);
+		std::string range;
+		while (std::getline(stream, range, ','))
+		{
+			if (range.empty() || range == "\n") continue;
+			try
+			{
+				auto separator = range.find('-');
+				unsigned int first = std::stoul(range.substr(0, separator));
+				unsigned int last = separator == std::string::npos ? first : std::stoul(range.substr(separator + 1));
+				for (auto index = first; index <= last; ++index)
+				{
+					processors.push_back(index);
+				}
+			}
+			catch (std::exception&)
+			{}
+		}
+		return processors;
+	}
+
+	/// 从系统中读取拓扑
+	CPUTopology CPUTopology::Detect(const std::string &root)
+	{
+		CPUTopology topology;
+
+		auto present = ReadFirstLine(root + "/present");
+		if (!present)
+		{
+			// 无法读取系统信息，则认为所有硬件线程在线且性能相同
+			auto count = std::max(1u, std::thread::hardware_concurrency());
+			for (unsigned int index = 0; index < count; ++index)
+			{
+				topology.Processors.push_back({index});
+			}
+			topology.Analyze();
+			return topology;
+		}
+
+		auto present_processors = ParseProcessorList(*present);
+		auto online = ReadFirstLine(root + "/online");
+		auto online_processors = online ? ParseProcessorList(*online) : present_processors;
+
+		for (auto index : present_processors)
+		{
+			ProcessorInfo info;
+			info.Index = index;
+			info.Online = std::find(online_processors.begin(), online_processors.end(), index)
+					!= online_processors.end();
+
+			auto directory = root + "/cpu" + std::to_string(index);
+
+			if (auto package = ReadInteger(directory + "/topology/physical_package_id"); package && *package > 0)
+			{
+				info.Package = static_cast<unsigned int>(*package);
+			}
+			if (auto capacity = ReadInteger(directory + "/cpu_capacity"); capacity && *capacity > 0)
+			{
+				info.Capacity = static_cast<unsigned int>(*capacity);
+			}
+			if (auto frequency = ReadInteger(directory + "/cpufreq/cpuinfo_max_freq"); frequency && *frequency > 0)
+			{
+				info.MaxFrequency = static_cast<std::uint64_t>(*frequency);
+			}
+
+			// 查找级别最高的缓存，记录与之共享该缓存的处理器
+			long long highest_level = 0;
+			for (unsigned int cache_index = 0;
+				boost::filesystem::exists(directory + "/cache/index" + std::to_string(cache_index)); ++cache_index)
+			{
+				auto cache_directory = directory + "/cache/index" + std::to_string(cache_index);
+				auto level = ReadInteger(cache_directory + "/level");
+				auto shared = ReadFirstLine(cache_directory + "/shared_cpu_list");
+				if (level && shared && *level > highest_level)
+				{
+					highest_level = *level;
+					info.SharedCacheProcessors = ParseProcessorList(*shared);
+				}
+			}
+
+			topology.Processors.push_back(std::move(info));
+		}
+
+		topology.Analyze();
+		return topology;
+	}
+
+	/// 从拓扑文件中加载拓扑
+	CPUTopology CPUTopology::Load(const std::string &path)
+	{
+		if (!boost::filesystem::exists(path))
+		{
+			throw std::runtime_error("[CPUTopology::Load] Topology File " + path + " does not Exist.");
+		}
+
+		CPUTopology topology;
+		try
+		{
+			boost::property_tree::ptree json_node;
+			boost::property_tree::read_json(path, json_node);
+
+			for (const auto& [key, processor_node] : json_node.get_child("Processors"))
+			{
+				ProcessorInfo info;
+				info.Index = processor_node.get<unsigned int>("Index");
+				info.Online = processor_node.get<bool>("Online", true);
+				info.Package = processor_node.get<unsigned int>("Package", 0);
+				info.Capacity = processor_node.get<unsigned int>("Capacity", 0);
+				info.MaxFrequency = processor_node.get<std::uint64_t>("MaxFrequency", 0);
+				if (auto shared_node = processor_node.get_child_optional("SharedCacheProcessors"))
+				{
+					if (shared_node->empty())
+					{
+						info.SharedCacheProcessors = ParseProcessorList(shared_node->get_value<std::string>());
+					}
+					for (const auto& [shared_key, shared_index_node] : *shared_node)
+					{
+						info.SharedCacheProcessors.push_back(shared_index_node.get_value<unsigned int>());
+					}
+				}
+				topology.Processors.push_back(std::move(info));
+			}
+		}
+		catch (boost::property_tree::ptree_error& error)
+		{
+			throw std::runtime_error("[CPUTopology::Load] Invalid Topology File: " + std::string(error.what()));
+		}
+
+		topology.Analyze();
+		return topology;
+	}
+
+	/// 根据处理器信息构建拓扑
+	CPUTopology CPUTopology::Create(std::vector<ProcessorInfo> processors)
+	{
+		CPUTopology topology;
+		topology.Processors = std::move(processors);
+		topology.Analyze();
+		return topology;
+	}
+
+	/// 查询是否存在快速簇
+	bool CPUTopology::HasFastCluster() const
+	{
+		return std::any_of(Clusters.begin(), Clusters.end(), [](const ClusterInfo& cluster){
+			return cluster.Fast;
+		});
+	}
+
+	/// 根据处理器信息划分簇
+	void CPUTopology::Analyze()
+	{
+		Clusters.clear();
+
+		// 优先使用相对性能，均未提供时使用最高频率
+		bool use_capacity = std::any_of(Processors.begin(), Processors.end(), [](const ProcessorInfo& info){
+			return info.Capacity > 0;
+		});
+
+		// 同一封装中性能相同且共享最后一级缓存的处理器归为一簇，缓存域以共享该缓存的最小处理器编号标识
+		std::map<std::tuple<unsigned int, std::uint64_t, unsigned int>, ClusterInfo> clusters;
+		for (const auto& info : Processors)
+		{
+			if (!info.Online) continue;
+
+			std::uint64_t performance = use_capacity ? info.Capacity : info.MaxFrequency;
+			auto cache_domain = info.SharedCacheProcessors.empty() ? std::numeric_limits<unsigned int>::max() :
+					*std::min_element(info.SharedCacheProcessors.begin(), info.SharedCacheProcessors.end());
+			auto& cluster = clusters[{info.Package, performance, cache_domain}];
+			cluster.Performance = performance;
+			cluster.Processors.push_back(info.Index);
+		}
+
+		for (auto& [key, cluster] : clusters)
+		{
+			Clusters.push_back(std::move(cluster));
+		}
+		std::stable_sort(Clusters.begin(), Clusters.end(), [](const ClusterInfo& left, const ClusterInfo& right){
+			return left.Performance > right.Performance;
+		});
+
+		// 存在多个性能等级时，最高等级的簇为快速簇
+		if (!Clusters.empty() && Clusters.front().Performance != Clusters.back().Performance)
+		{
+			for (auto& cluster : Clusters)
+			{
+				cluster.Fast = cluster.Performance == Clusters.front().Performance;
+			}
+		}
+	}
+
+	/// 获取在线的处理器
+	std::vector<unsigned int> CPUTopology::GetOnlineProcessors() const
+	{
+		std::vector<unsigned int> processors;
+		for (const auto& info : Processors)
+		{
+			if (info.Online)
+			{
+				processors.push_back(info.Index);
+			}
+		}
+		return processors;
+	}
+
+	/// 获取快速处理器
+	std::vector<unsigned int> CPUTopology::GetFastProcessors() const
+	{
+		std::vector<unsigned int> processors;
+		for (const auto& cluster : Clusters)
+		{
+			if (!cluster.Fast) continue;
+			processors.insert(processors.end(), cluster.Processors.begin(), cluster.Processors.end());
+		}
+		std::sort(processors.begin(), processors.end());
+		return processors;
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace Galaxy
+{
+	/**
+	 * @brief 处理器拓扑
+	 * @author Vincent
+	 * @details
+	 *  ~ 描述各个处理器的在线状态、所属封装、性能和共享缓存，并据此将在线的处理器划分为簇。
+	 *  ~ 同一封装中性能相同且共享同一个最后一级缓存的处理器属于同一簇，例如多个CCX的处理器中每个CCX各为一簇；
+	 *    未知共享缓存的处理器按照封装和性能归簇。存在多个性能等级时，最高等级的处理器被视为快速处理器。
+	 *  ~ 性能优先以cpu_capacity衡量，若所有处理器均未提供该值，则以最高频率衡量。
+	 */
+	class CPUTopology
+	{
+	public:
+		/// 处理器信息
+		struct ProcessorInfo
+		{
+			/// 处理器编号
+			unsigned int Index {0};
+			/// 是否在线
+			bool Online {true};
+			/// 所属封装编号
+			unsigned int Package {0};
+			/// 相对性能，为0时表示未知
+			unsigned int Capacity {0};
+			/// 最高频率，单位为千赫兹，为0时表示未知
+			std::uint64_t MaxFrequency {0};
+			/// 与该处理器共享最后一级缓存的处理器编号列表
+			std::vector<unsigned int> SharedCacheProcessors {};
+		};
+
+		/// 簇信息
+		struct ClusterInfo
+		{
+			/// 簇中在线的处理器编号列表
+			std::vector<unsigned int> Processors {};
+			/// 簇的性能等级，数值越大性能越高
+			std::uint64_t Performance {0};
+			/// 是否为快速簇
+			bool Fast {false};
+		};
+
+		/// 处理器列表，包括离线的处理器
+		std::vector<ProcessorInfo> Processors {};
+		/// 簇列表，按照性能由高到低排列，只包含在线的处理器
+		std::vector<ClusterInfo> Clusters {};
+
+		/**
+		 * @brief 从系统中读取拓扑
+		 * @param root 处理器信息目录
+		 * @return 处理器拓扑
+		 * @details
+		 *  ~ 若无法读取该目录，则认为所有硬件线程均在线且性能相同。
+		 */
+		static CPUTopology Detect(const std::string& root = "/sys/devices/system/cpu");
+
+		/**
+		 * @brief 从拓扑文件中加载拓扑
+		 * @param path JSON格式的拓扑文件路径
+		 * @throw std::runtime_error 当文件不存在或格式错误
+		 * @return 处理器拓扑
+		 * @details
+		 *  ~ 文件中的Processors数组的每一项描述一个处理器，Index为必填项，
+		 *    Online、Package、Capacity、MaxFrequency、SharedCacheProcessors为可选项。
+		 *  ~ SharedCacheProcessors可以是编号数组，也可以是形如"0-3,8"的处理器列表文本。
+		 */
+		static CPUTopology Load(const std::string& path);
+
+		/**
+		 * @brief 根据处理器信息构建拓扑
+		 * @param processors 处理器信息列表
+		 * @return 处理器拓扑
+		 * @details
+		 *  ~ 用于在代码中描述固定的拓扑，簇的划分规则与从系统中读取时相同。
+		 */
+		static CPUTopology Create(std::vector<ProcessorInfo> processors);
+
+		/**
+		 * @brief 查询是否存在快速簇
+		 * @retval true 存在多个性能等级，已划分出快速簇
+		 * @retval false 所有处理器性能相同，或无法区分性能
+		 */
+		[[nodiscard]] bool HasFastCluster() const;
+
+		/**
+		 * @brief 获取在线的处理器
+		 * @return 在线的处理器编号列表
+		 */
+		[[nodiscard]] std::vector<unsigned int> GetOnlineProcessors() const;
+
+		/**
+		 * @brief 获取快速处理器
+		 * @return 快速簇中在线的处理器编号列表，所有处理器性能相同时为空
+		 */
+		[[nodiscard]] std::vector<unsigned int> GetFastProcessors() const;
+
+	private:
+		/// 根据处理器信息划分簇
+		void Analyze();
+	};
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+
+namespace Galaxy::Core
+{
+	/**
+	 * @brief 抽象可等待对象
+	 * @author Vincent
+	 * @details
+	 *  ~ 流处理器可以在执行方法中等待该对象；对象未就绪时，宿主工作流将离开执行器，
+	 *    直至对象完成时由完成者将其重新提交，等待期间不占用任何执行器线程。
+	 *  ~ 除非派生类另有说明，同一时刻只允许一个流处理器等待同一对象；对象的生命周期应当长于等待过程，通常作为流处理器的成员。
+	 */
+	class AbstractAwaitable
+	{
+	public:
+		/// 虚析构函数
+		virtual ~AbstractAwaitable() = default;
+
+		/**
+		 * @brief 查询是否已经就绪
+		 * @retval true 已经就绪，流处理器将直接继续执行，不会挂起
+		 * @retval false 尚未就绪，流处理器将挂起并订阅完成事件
+		 */
+		[[nodiscard]] virtual bool IsReady() = 0;
+
+		/**
+		 * @brief 订阅完成事件
+		 * @param resume 恢复函数器
+		 * @details
+		 *  ~ 在宿主工作流已被标记为挂起后调用，对象完成时须恰好调用一次恢复函数器；
+		 *    若对象在订阅期间已经完成，可以在调用线程中立即调用。
+		 *  ~ 恢复函数器只进行计数和提交操作，可以在任意线程中调用，包括设备驱动的回调线程。
+		 */
+		virtual void Subscribe(std::function<void()> resume) = 0;
+	};
+}
@@ -2,11 +2,30 @@
 #include "AbstractWorkflow.hpp"
 #include "Tools/WorkflowAccess.hpp"
 #include <stdexcept>
+#include <typeinfo>
 #include <pthread.h>
 #include <thread>
+#include <climits>
+#include <algorithm>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <alloca.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <mutex>
 
 namespace Galaxy::Core
 {
+	/// 当前线程所属的执行器，由执行器准备工作线程时设置
+	thread_local AbstractExecutor* CurrentThreadOwner {nullptr};
+	/// 当前线程正在进行的放弃操作的嵌套深度
+	thread_local unsigned int DiscardingDepth {0};
+
 	//==============================
 	// 线程控制部分
 	//==============================
@@ -47,17 +66,148 @@ namespace Galaxy::Core
 		sched_setaffinity(0, sizeof(mask), &mask);
 	}
 
-	/// 执行器工作线程
-	void ExecutorWorkingThread(AbstractExecutor *executor, const std::vector<unsigned int>& cpus)
+	/// 在CPU暂停指令上自旋一次
+	inline void RelaxCPU()
+	{
+		#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+		#elif defined(__aarch64__) || defined(__arm__)
+		asm volatile("yield");
+		#endif
+	}
+
+	/// 获取单调时钟的当前时间，单位为纳秒
+	inline std::int64_t GetMonotonicNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief 在futex上等待
+	 * @param address 等待的地址
+	 * @param expected 期望值，若地址上的值已经不等于该值，则立即返回
+	 * @param timeout 最长等待时间
+	 * @retval true 被唤醒
+	 * @retval false 等待超时、值已改变或被信号中断
+	 */
+	bool WaitOnFutex(std::atomic<std::uint32_t>* address, std::uint32_t expected, std::chrono::microseconds timeout)
+	{
+		timespec time_limit {};
+		time_limit.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+		time_limit.tv_nsec = static_cast<long>(timeout.count() % 1000000 * 1000);
+		return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(address), FUTEX_WAIT_PRIVATE, expected,
+		               &time_limit, nullptr, 0) == 0;
+	}
+
+	/**
+	 * @brief 唤醒在futex上等待的线程
+	 * @param address 等待的地址
+	 * @param count 最多唤醒的线程数
+	 */
+	void WakeOnFutex(std::atomic<std::uint32_t>* address, int count)
+	{
+		syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(address), FUTEX_WAKE_PRIVATE, count,
+		        nullptr, nullptr, 0);
+	}
+
+	/**
+	 * @brief 锁定进程内存
+	 * @retval true 进程内存已被锁定
+	 * @retval false 锁定失败
+	 * @details
+	 *  ~ 内存锁定对整个进程生效，故只尝试一次。
+	 */
+	bool LockProcessMemory()
+	{
+		static std::once_flag lock_flag;
+		static bool locked = false;
+		std::call_once(lock_flag, []{
+			locked = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+			if (!locked)
+			{
+				std::cerr << "[Warning] Failed to Lock Process Memory: " << std::strerror(errno) << std::endl;
+			}
+		});
+		return locked;
+	}
+
+	/**
+	 * @brief 预先触及调用线程的栈
+	 * @param size 需要触及的字节数
+	 * @details
+	 *  ~ 使栈页面在工作开始前就被映射，避免工作过程中首次使用栈空间时发生缺页。
+	 */
+	void PrefaultCurrentStack(std::size_t size)
 	{
-		if (!cpus.empty())
+		auto* stack = static_cast<volatile unsigned char*>(alloca(size));
+		for (std::size_t offset = 0; offset < size; offset += 4096)
 		{
-			SetCurrentThreadCPUAffinity(cpus);
+			stack[offset] = 0;
 		}
+	}
+
+	/// 执行器工作线程
+	void ExecutorWorkingThread(AbstractExecutor *executor)
+	{
+		executor->PrepareCurrentThread();
 
 		executor->LaunchWorkingThread();
 	}
 
+	/// 准备当前线程
+	void AbstractExecutor::PrepareCurrentThread()
+	{
+		CurrentThreadOwner = this;
+
+		if (!CurrentCPUAffinity.empty())
+		{
+			SetCurrentThreadCPUAffinity(CurrentCPUAffinity);
+		}
+
+		ApplySchedulingOptions();
+	}
+
+	/// 应用调度选项
+	void AbstractExecutor::ApplySchedulingOptions()
+	{
+		const auto& options = CurrentSchedulingOptions;
+
+		if (options.LockMemory && !LockProcessMemory())
+		{
+			SchedulingDegraded = true;
+		}
+
+		if (options.Policy != SchedulingOptions::PolicyType::Normal)
+		{
+			sched_param parameter {};
+			parameter.sched_priority = options.RealtimePriority;
+			int policy = options.Policy == SchedulingOptions::PolicyType::FIFO ? SCHED_FIFO : SCHED_RR;
+			int result = pthread_setschedparam(pthread_self(), policy, &parameter);
+			if (result != 0)
+			{
+				// 缺少权限时保持普通调度
+				SchedulingDegraded = true;
+				std::cerr << "[Warning] Failed to Apply Real-time Scheduling, Keep Normal Scheduling: "
+						  << std::strerror(result) << std::endl;
+			}
+		}
+		else if (options.NiceValue)
+		{
+			// 在Linux下，nice值是线程级别的属性
+			if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), *options.NiceValue) != 0)
+			{
+				SchedulingDegraded = true;
+				std::cerr << "[Warning] Failed to Set Nice Value: " << std::strerror(errno) << std::endl;
+			}
+		}
+
+		if (options.PrefaultStackSize > 0)
+		{
+			PrefaultCurrentStack(options.PrefaultStackSize);
+		}
+	}
+
 	/// 启动工作线程
 	void AbstractExecutor::LaunchWorkingThread()
 	{
@@ -78,6 +228,10 @@ namespace Galaxy::Core
 		}
 
  		Working = false;
+
+		// 释放所有等待容量的提交者
+		std::unique_lock lock(CapacityMutex);
+		CapacityCondition.notify_all();
 	}
 
 	//==============================
@@ -102,7 +256,7 @@ namespace Galaxy::Core
 			LifeFlag = true;
 
 			WorkingThread = std::make_unique<std::thread>([this]{
-				ExecutorWorkingThread(this, this->CurrentCPUAffinity);
+				ExecutorWorkingThread(this);
 			});
 		}
 	}
@@ -111,6 +265,13 @@ namespace Galaxy::Core
 	void AbstractExecutor::Stop()
 	{
 		LifeFlag = false;
+
+		// 唤醒所有挂起的工作线程，使其尽快检查生命旗标
+		WakeUpAllThreads();
+
+		// 释放所有等待容量的提交者
+		std::unique_lock lock(CapacityMutex);
+		CapacityCondition.notify_all();
 	}
 
 	/// 阻塞调用线程
@@ -134,6 +295,94 @@ namespace Galaxy::Core
 		}
 	}
 
+	/// 空闲等待
+	void AbstractExecutor::Idle(unsigned int &idle_rounds)
+	{
+		++idle_rounds;
+
+		// 自旋阶段
+		if (idle_rounds <= CurrentIdlePolicy.SpinTimes)
+		{
+			RelaxCPU();
+			return;
+		}
+
+		// 让出时间片阶段
+		if (!CurrentIdlePolicy.EnablePark ||
+			idle_rounds <= CurrentIdlePolicy.SpinTimes + CurrentIdlePolicy.YieldTimes)
+		{
+			std::this_thread::yield();
+			return;
+		}
+
+		// 挂起阶段，先读取唤醒序号再确认队列，保证挂起期间提交的任务一定会改变唤醒序号
+		auto sequence = WakeUpSequence.load();
+		bool woken = false;
+		ParkedThreadsCount.fetch_add(1);
+		if (!HasQueuedTasks() && LifeFlag)
+		{
+			woken = WaitOnFutex(&WakeUpSequence, sequence, CurrentIdlePolicy.ParkTimeout);
+		}
+		ParkedThreadsCount.fetch_sub(1);
+
+		// 若是被唤醒，则记录唤醒延迟
+		if (woken)
+		{
+			auto request_time = WakeUpRequestTime.load();
+			if (request_time != 0)
+			{
+				auto latency = GetMonotonicNanoseconds() - request_time;
+				if (latency >= 0)
+				{
+					WakeUpCount.fetch_add(1);
+					WakeUpTotalLatency.fetch_add(latency);
+					auto max_latency = WakeUpMaxLatency.load();
+					while (latency > max_latency && !WakeUpMaxLatency.compare_exchange_weak(max_latency, latency))
+					{}
+				}
+			}
+		}
+
+		// 醒来后重新从自旋阶段开始
+		idle_rounds = 0;
+	}
+
+	/// 通知有新任务
+	void AbstractExecutor::NotifyTasks(unsigned int count)
+	{
+		WakeUpSequence.fetch_add(1);
+		if (ParkedThreadsCount.load() > 0)
+		{
+			WakeUpRequestTime.store(GetMonotonicNanoseconds());
+			WakeOnFutex(&WakeUpSequence, static_cast<int>(std::min<unsigned int>(count, INT_MAX)));
+		}
+	}
+
+	/// 唤醒所有挂起的工作线程
+	void AbstractExecutor::WakeUpAllThreads()
+	{
+		WakeUpSequence.fetch_add(1);
+		WakeOnFutex(&WakeUpSequence, INT_MAX);
+	}
+
+	/// 获取唤醒统计
+	AbstractExecutor::WakeUpStatistics AbstractExecutor::GetWakeUpStatistics() const
+	{
+		WakeUpStatistics statistics;
+		statistics.Count = WakeUpCount.load();
+		statistics.TotalLatency = std::chrono::nanoseconds(WakeUpTotalLatency.load());
+		statistics.MaxLatency = std::chrono::nanoseconds(WakeUpMaxLatency.load());
+		return statistics;
+	}
+
+	/// 重置唤醒统计
+	void AbstractExecutor::ResetWakeUpStatistics()
+	{
+		WakeUpCount = 0;
+		WakeUpTotalLatency = 0;
+		WakeUpMaxLatency = 0;
+	}
+
 	/// 设置停止条件
 	void AbstractExecutor::SetStopCondition(std::function<bool()> stop_condition)
 	{
@@ -157,15 +406,27 @@ namespace Galaxy::Core
 	{
 		if (workflow)
 		{
-			auto result = Tools::WorkflowAccess::IterateExecute(workflow);
-			if (result)
+			unsigned int inline_hops = 0;
+			while (true)
 			{
+				auto result = Tools::WorkflowAccess::IterateExecute(workflow);
+				if (!result) break;
+
 				if (!(*result))
 				{
 					throw std::runtime_error("[AbstractExecutor::InvokeWorkflow] Executor Pointer is Null.");
 				}
 
+				// 下一个流处理器仍在本执行器上，且未达到连续执行上限，则直接继续执行
+				if (*result == this && inline_hops < MaxInlineHops)
+				{
+					++inline_hops;
+					InlinedHopsCount.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+
 				(*result)->Submit(workflow);
+				break;
 			}
 		}
 		else
@@ -174,12 +435,201 @@ namespace Galaxy::Core
 		}
 	}
 
+	/// 接纳任务
+	bool AbstractExecutor::AdmitTask(AbstractWorkflow *workflow)
+	{
+		// 不限容量且不合并时，直接接纳
+		if (QueueCapacity == 0 && QueueOverflowPolicy != OverflowPolicy::Coalesce)
+		{
+			++QueuedTasksCount;
+			SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		// 合并策略下，新工作流取代同类型的排队者，并继承其在队列中的名额；
+		// 被放弃后重新提交的工作流不参与合并，否则两个循环的同类型工作流将互相取代，任何一次迭代都无法完成
+		if (QueueOverflowPolicy == OverflowPolicy::Coalesce && DiscardingDepth == 0 &&
+			Tools::WorkflowAccess::IsCoalescable(workflow))
+		{
+			std::unique_lock lock(CoalescingMutex);
+			auto& latest = CoalescingTable[std::type_index(typeid(*workflow))];
+			auto* superseded = latest;
+			latest = workflow;
+			// 标记需要在锁内完成，保证被取代者认领时一定能看到标记
+			if (superseded && superseded != workflow)
+			{
+				Tools::WorkflowAccess::MarkSuperseded(superseded);
+			}
+			lock.unlock();
+
+			if (superseded && superseded != workflow)
+			{
+				CoalescedCount.fetch_add(1, std::memory_order_relaxed);
+				SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		// 由放弃操作引发的重新提交不受容量限制，以避免连锁放弃
+		if (QueueCapacity == 0 || DiscardingDepth > 0)
+		{
+			++QueuedTasksCount;
+			SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		if (TryReserveQueueSlot())
+		{
+			SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		// 未能预留名额时是否仍然强制入队
+		bool forced = true;
+		switch (QueueOverflowPolicy)
+		{
+			case OverflowPolicy::Block:
+				// 在本执行器的工作线程中提交时不阻塞，否则将无人消费队列
+				if (CurrentThreadOwner != this && Working)
+				{
+					BlockedCount.fetch_add(1, std::memory_order_relaxed);
+					std::unique_lock lock(CapacityMutex);
+					++BlockedSubmittersCount;
+					// 每次被唤醒都需要重新预留，被同时唤醒的提交者中只有抢到名额的才能继续
+					CapacityCondition.wait(lock, [this, &forced]{
+						forced = !TryReserveQueueSlot();
+						return !forced || !LifeFlag || !Working;
+					});
+					--BlockedSubmittersCount;
+				}
+				break;
+			case OverflowPolicy::Reject:
+				RejectedCount.fetch_add(1, std::memory_order_relaxed);
+				DiscardWorkflow(workflow);
+				return false;
+			case OverflowPolicy::DropOldest:
+			case OverflowPolicy::Coalesce:
+			{
+				// 每放弃一个最旧的排队者就尝试预留其名额，名额被其他提交者抢走时继续放弃
+				AbstractWorkflow* oldest {nullptr};
+				while (forced && TakeOldestTask(oldest))
+				{
+					// 已被取代的排队者在认领时即被放弃，需要继续寻找
+					if (ClaimTask(oldest))
+					{
+						DroppedCount.fetch_add(1, std::memory_order_relaxed);
+						DiscardWorkflow(oldest);
+						forced = !TryReserveQueueSlot();
+					}
+				}
+				break;
+			}
+		}
+
+		// 执行器停止或队列中已无可放弃的任务时，仍然接纳该工作流
+		if (forced)
+		{
+			++QueuedTasksCount;
+		}
+		SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/// 尝试预留队列名额
+	bool AbstractExecutor::TryReserveQueueSlot()
+	{
+		auto count = QueuedTasksCount.load();
+		while (count < QueueCapacity)
+		{
+			if (QueuedTasksCount.compare_exchange_weak(count, count + 1))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// 认领任务
+	bool AbstractExecutor::ClaimTask(AbstractWorkflow *workflow)
+	{
+		if (QueueOverflowPolicy == OverflowPolicy::Coalesce && Tools::WorkflowAccess::IsCoalescable(workflow))
+		{
+			std::unique_lock lock(CoalescingMutex);
+			// 被取代的工作流的名额已经转交给取代者
+			if (Tools::WorkflowAccess::ResetSuperseded(workflow))
+			{
+				lock.unlock();
+				DiscardWorkflow(workflow);
+				return false;
+			}
+
+			auto finder = CoalescingTable.find(std::type_index(typeid(*workflow)));
+			if (finder != CoalescingTable.end() && finder->second == workflow)
+			{
+				CoalescingTable.erase(finder);
+			}
+		}
+
+		--QueuedTasksCount;
+
+		if (BlockedSubmittersCount > 0)
+		{
+			std::unique_lock lock(CapacityMutex);
+			CapacityCondition.notify_one();
+		}
+		return true;
+	}
+
+	/// 放弃工作流
+	void AbstractExecutor::DiscardWorkflow(AbstractWorkflow *workflow)
+	{
+		++DiscardingDepth;
+		try
+		{
+			auto next_executor = Tools::WorkflowAccess::Abort(workflow);
+			if (next_executor && *next_executor)
+			{
+				(*next_executor)->Submit(workflow);
+			}
+		}
+		catch (...)
+		{
+			--DiscardingDepth;
+			throw;
+		}
+		--DiscardingDepth;
+	}
+
+	/// 获取队列统计
+	AbstractExecutor::QueueStatistics AbstractExecutor::GetQueueStatistics() const
+	{
+		QueueStatistics statistics;
+		statistics.Submitted = SubmittedCount.load();
+		statistics.Rejected = RejectedCount.load();
+		statistics.Dropped = DroppedCount.load();
+		statistics.Coalesced = CoalescedCount.load();
+		statistics.Blocked = BlockedCount.load();
+		return statistics;
+	}
+
+	/// 重置队列统计
+	void AbstractExecutor::ResetQueueStatistics()
+	{
+		SubmittedCount = 0;
+		RejectedCount = 0;
+		DroppedCount = 0;
+		CoalescedCount = 0;
+		BlockedCount = 0;
+	}
+
 	/// 提交工作流
 	void AbstractExecutor::Submit(AbstractWorkflow *workflow)
 	{
 		if (workflow)
 		{
-			Tasks.push(workflow);
+			if (!AdmitTask(workflow)) return;
+
+			Tasks.Push(workflow);
+			NotifyTasks();
 		}
 		else
 		{
@@ -187,4 +637,46 @@ namespace Galaxy::Core
 		}
 	}
 
+	/// 批量提交工作流
+	void AbstractExecutor::SubmitBatch(const std::vector<AbstractWorkflow *> &workflows)
+	{
+		for (auto* workflow : workflows)
+		{
+			Submit(workflow);
+		}
+	}
+
+	/// 并行执行循环
+	void AbstractExecutor::ParallelFor(std::size_t begin, std::size_t end,
+									   const std::function<void(std::size_t, std::size_t)> &body,
+									   std::size_t)
+	{
+		// 串行执行时不拆分区间，子区间的最小长度没有意义
+		if (begin < end)
+		{
+			body(begin, end);
+		}
+	}
+
+	/// 批量提交到任务队列
+	void AbstractExecutor::SubmitBatchToTasks(const std::vector<AbstractWorkflow *> &workflows)
+	{
+		TaskChain chain;
+		for (auto* workflow : workflows)
+		{
+			if (!workflow)
+			{
+				throw std::runtime_error("[AbstractExecutor::SubmitBatch] Workflow Pointer is Null.");
+			}
+			if (AdmitTask(workflow))
+			{
+				chain.Append(workflow);
+			}
+		}
+		if (chain.Empty()) return;
+
+		Tasks.Push(chain);
+		NotifyTasks(static_cast<unsigned int>(chain.Size()));
+	}
+
 }
\ No newline at end of file
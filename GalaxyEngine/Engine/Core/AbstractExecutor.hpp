@@ -5,8 +5,17 @@
 #include <memory>
 #include <vector>
 #include <tbb/tbb.h>
+#include "IntrusiveTaskQueue.hpp"
 #include <initializer_list>
 #include <shared_mutex>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <typeindex>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+#include <optional>
 
 namespace Galaxy::Core
 {
@@ -24,7 +33,113 @@ namespace Galaxy::Core
 	class AbstractExecutor
 	{
 		/// 声明执行器工作线程函数为友元
-		friend void ExecutorWorkingThread(AbstractExecutor* executor, const std::vector<unsigned int>& cpus);
+		friend void ExecutorWorkingThread(AbstractExecutor* executor);
+
+	public:
+		/**
+		 * @brief 空闲策略
+		 * @details
+		 *  ~ 工作线程没有任务可执行时，先自旋指定次数，再让出指定次数的时间片，最后挂起等待提交唤醒。
+		 *  ~ 自旋和让出时间片的唤醒延迟低，但会持续占用CPU；挂起不占用CPU，但唤醒需要经过内核调度。
+		 */
+		struct IdlePolicy
+		{
+			/// 自旋次数，自旋期间将执行CPU暂停指令
+			unsigned int SpinTimes {256};
+			/// 自旋结束后让出时间片的次数
+			unsigned int YieldTimes {64};
+			/// 是否允许挂起，若为false，则将一直让出时间片
+			bool EnablePark {true};
+			/// 单次挂起的最长时间，超时后工作线程将重新检查停止条件
+			std::chrono::microseconds ParkTimeout {10000};
+		};
+
+		/**
+		 * @brief 调度选项
+		 * @details
+		 *  ~ 工作线程启动时将应用这些选项，缺少权限时将输出警告并保持原有设置。
+		 *  ~ 实时调度策略可以避免工作线程被后台进程抢占，但占满CPU的实时线程会使同一CPU上的普通线程无法运行。
+		 */
+		struct SchedulingOptions
+		{
+			/// 调度策略类型
+			enum class PolicyType
+			{
+				/// 普通分时调度，即SCHED_OTHER
+				Normal,
+				/// 先进先出实时调度，即SCHED_FIFO
+				FIFO,
+				/// 时间片轮转实时调度，即SCHED_RR
+				RoundRobin
+			};
+
+			/// 调度策略
+			PolicyType Policy {PolicyType::Normal};
+			/// 实时优先级，仅对实时调度策略有效，取值范围通常为1至99
+			int RealtimePriority {1};
+			/// nice值，仅对普通调度策略有效，为空时不修改
+			std::optional<int> NiceValue {};
+			/// 是否锁定进程的全部内存，避免缺页导致的延迟，该选项对整个进程生效
+			bool LockMemory {false};
+			/// 工作线程启动时预先触及的栈大小，单位为字节，应当小于线程栈的大小，为0时不预先触及
+			std::size_t PrefaultStackSize {0};
+		};
+
+		/**
+		 * @brief 唤醒统计
+		 * @details
+		 *  ~ 记录挂起的工作线程从提交发出唤醒到其恢复运行所经过的时间。
+		 */
+		struct WakeUpStatistics
+		{
+			/// 被提交唤醒的次数
+			std::uint64_t Count {0};
+			/// 唤醒延迟总和
+			std::chrono::nanoseconds TotalLatency {0};
+			/// 最大唤醒延迟
+			std::chrono::nanoseconds MaxLatency {0};
+
+			/// 获取平均唤醒延迟
+			[[nodiscard]] std::chrono::nanoseconds GetAverageLatency() const
+			{
+				return Count > 0 ? TotalLatency / static_cast<std::int64_t>(Count) : std::chrono::nanoseconds(0);
+			}
+		};
+
+		/**
+		 * @brief 队列溢出策略
+		 * @details
+		 *  ~ 被放弃的工作流将放弃本次迭代，其结束事件会被调用，若开启了循环，则将从头开始下一次迭代。
+		 */
+		enum class OverflowPolicy
+		{
+			/// 阻塞提交者，直至队列有空位；在本执行器的工作线程中提交时不会阻塞
+			Block,
+			/// 拒绝新提交的工作流，即放弃最新的工作流
+			Reject,
+			/// 放弃队列中最早的工作流
+			DropOldest,
+			/// 每种工作流类型至多排队一个，新提交的工作流将取代同类型的排队者；队列已满时放弃最早的工作流。
+			/// 被放弃后重新提交的工作流不会取代其他排队者
+			Coalesce
+		};
+
+		/**
+		 * @brief 队列统计
+		 */
+		struct QueueStatistics
+		{
+			/// 被接受的提交次数
+			std::uint64_t Submitted {0};
+			/// 因队列已满而被拒绝的工作流数
+			std::uint64_t Rejected {0};
+			/// 因队列已满而被放弃的排队工作流数
+			std::uint64_t Dropped {0};
+			/// 被同类型工作流取代的工作流数
+			std::uint64_t Coalesced {0};
+			/// 提交者因队列已满而被阻塞的次数
+			std::uint64_t Blocked {0};
+		};
 
 	private:
 		/// 线程是否正在工作
@@ -48,12 +163,187 @@ namespace Galaxy::Core
 		/// 是否启用终止条件
 		std::atomic_bool EnableStopCondition {false};
 
+		/// 当前空闲策略
+		IdlePolicy CurrentIdlePolicy {};
+
+		/// 当前调度选项
+		SchedulingOptions CurrentSchedulingOptions {};
+		/// 是否有调度选项未能生效
+		std::atomic_bool SchedulingDegraded {false};
+
+		/// 将调度选项应用到调用线程
+		void ApplySchedulingOptions();
+
+		/// 队列容量，为0时不限制
+		std::size_t QueueCapacity {0};
+		/// 队列溢出策略
+		OverflowPolicy QueueOverflowPolicy {OverflowPolicy::Block};
+		/// 排队中的任务数
+		std::atomic_size_t QueuedTasksCount {0};
+
+		/// 容量等待互斥量
+		std::mutex CapacityMutex;
+		/// 容量等待条件变量
+		std::condition_variable CapacityCondition;
+		/// 正在等待容量的提交者数量
+		std::atomic<std::uint32_t> BlockedSubmittersCount {0};
+
+		/// 合并表互斥量
+		std::mutex CoalescingMutex;
+		/// 合并表，记录每种工作流类型最新排队的工作流
+		std::unordered_map<std::type_index, AbstractWorkflow*> CoalescingTable;
+
+		/// 被接受的提交次数
+		std::atomic<std::uint64_t> SubmittedCount {0};
+		/// 被拒绝的工作流数
+		std::atomic<std::uint64_t> RejectedCount {0};
+		/// 被放弃的排队工作流数
+		std::atomic<std::uint64_t> DroppedCount {0};
+		/// 被取代的工作流数
+		std::atomic<std::uint64_t> CoalescedCount {0};
+		/// 提交者被阻塞的次数
+		std::atomic<std::uint64_t> BlockedCount {0};
+
+		/// 同一工作流在本执行器上连续直接执行的最大次数
+		unsigned int MaxInlineHops {16};
+		/// 被直接执行而省去的提交次数
+		std::atomic<std::uint64_t> InlinedHopsCount {0};
+
+		/// 唤醒序号，提交时递增，挂起的工作线程在该值上等待
+		std::atomic<std::uint32_t> WakeUpSequence {0};
+		/// 正在挂起的工作线程数
+		std::atomic<std::uint32_t> ParkedThreadsCount {0};
+		/// 最近一次发出唤醒的时间，单位为纳秒
+		std::atomic<std::int64_t> WakeUpRequestTime {0};
+
+		/// 唤醒次数
+		std::atomic<std::uint64_t> WakeUpCount {0};
+		/// 唤醒延迟总和，单位为纳秒
+		std::atomic<std::int64_t> WakeUpTotalLatency {0};
+		/// 最大唤醒延迟，单位为纳秒
+		std::atomic<std::int64_t> WakeUpMaxLatency {0};
+
 	protected:
 		/// 工作线程生命循环更新事件
 		virtual void OnUpdateWorkingThread() = 0;
 
-		/// 被委派的任务队列
-		tbb::concurrent_queue<AbstractWorkflow*> Tasks;
+		/**
+		 * @brief 被委派的任务队列
+		 * @details
+		 *  ~ 侵入式无锁队列，入队不分配内存；同一时刻只有一个线程可以出队。
+		 */
+		IntrusiveTaskQueue Tasks;
+
+		/**
+		 * @brief 查询是否有排队中的任务
+		 * @retval true 存在尚未被取出的任务
+		 * @retval false 没有排队中的任务
+		 * @details
+		 *  ~ 工作线程挂起前将调用该方法再次确认，使用自有队列的派生类应当重载该方法。
+		 */
+		[[nodiscard]] virtual bool HasQueuedTasks() const
+		{
+			return QueuedTasksCount > 0;
+		}
+
+		/**
+		 * @brief 接纳任务
+		 * @param workflow 将要入队的工作流
+		 * @retval true 调用者应当将该工作流放入队列
+		 * @retval false 该工作流已被拒绝或放弃，调用者不应将其入队
+		 * @details
+		 *  ~ 派生类的提交方法在入队前应当调用该方法，该方法将按照队列容量和溢出策略进行处理。
+		 */
+		bool AdmitTask(AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 尝试预留队列名额
+		 * @retval true 已预留一个名额，排队任务数已经增加
+		 * @retval false 队列已满
+		 * @details
+		 *  ~ 检查与增加通过比较交换一次完成，并发的提交者不会同时越过容量限制。
+		 */
+		bool TryReserveQueueSlot();
+
+		/**
+		 * @brief 认领任务
+		 * @param workflow 刚刚出队的工作流
+		 * @retval true 调用者应当执行该工作流
+		 * @retval false 该工作流已被取代并已被放弃，调用者不应执行
+		 * @details
+		 *  ~ 派生类从队列中取出工作流后应当调用该方法。
+		 */
+		bool ClaimTask(AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 取出最早排队的任务
+		 * @param workflow 用于存放取出的工作流
+		 * @retval true 成功取出
+		 * @retval false 队列为空
+		 * @details
+		 *  ~ 用于放弃最早的工作流，使用自有队列的派生类应当重载该方法。
+		 */
+		virtual bool TakeOldestTask(AbstractWorkflow*& workflow)
+		{
+			return Tasks.TryPop(workflow, true);
+		}
+
+		/**
+		 * @brief 放弃工作流
+		 * @param workflow 被放弃的工作流
+		 * @details
+		 *  ~ 工作流将放弃本次迭代，若开启了循环，则将被提交给其第一个执行器，该次提交不受队列容量限制。
+		 */
+		void DiscardWorkflow(AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 空闲等待
+		 * @param idle_rounds 调用线程连续空闲的次数，由调用线程持有，执行任务后应当将其清零
+		 * @details
+		 *  ~ 工作线程找不到任务时调用该方法，将按照空闲策略自旋、让出时间片或挂起。
+		 *  ~ 挂起的线程将被提交、停止或挂起超时唤醒。
+		 */
+		void Idle(unsigned int& idle_rounds);
+
+		/**
+		 * @brief 通知有新任务
+		 * @param count 新任务的数量
+		 * @details
+		 *  ~ 派生类在将任务放入队列后应当调用该方法，若有工作线程挂起，则将唤醒至多count个。
+		 */
+		void NotifyTasks(unsigned int count = 1);
+
+		/**
+		 * @brief 批量提交到任务队列
+		 * @param workflows 工作流指针列表
+		 * @details
+		 *  ~ 供使用任务队列的派生类实现批量提交，被接纳的工作流将被串联后一次性放入队列。
+		 */
+		void SubmitBatchToTasks(const std::vector<AbstractWorkflow*>& workflows);
+
+		/**
+		 * @brief 唤醒所有挂起的工作线程
+		 * @details
+		 *  ~ 用于停止执行器等需要工作线程尽快检查自身状态的场合。
+		 */
+		void WakeUpAllThreads();
+
+		/**
+		 * @brief 准备当前线程
+		 * @details
+		 *  ~ 将执行器的CPU亲和性和调度选项等线程属性应用到调用线程上。
+		 *  ~ 工作线程启动时会自动调用该方法，派生类自行创建的辅助工作线程也应当调用该方法。
+		 */
+		void PrepareCurrentThread();
+
+		/**
+		 * @brief 获取CPU亲和性
+		 * @return 当前设置的处理器编号列表
+		 */
+		[[nodiscard]] const std::vector<unsigned int>& GetCPUAffinity() const
+		{
+			return CurrentCPUAffinity;
+		}
 
 		/**
 		 * @brief 执行工作流
@@ -62,8 +352,10 @@ namespace Galaxy::Core
 		 * @details
 		 *  ~ 该方法是给派生类提供的，用于与抽象通道交互。
 		 *  ~ 方法内部将调用工作流暴露的接口，阻塞式执行完毕后，将该管道提交给下一个执行器。
+		 *  ~ 若下一个流处理器仍在本执行器上执行，则将在当前线程中直接继续执行，不再重新排队，
+		 *    连续直接执行的次数受MaxInlineHops限制，达到上限后将重新提交给自身以保证公平。
 		 */
-		static void InvokeWorkflow(AbstractWorkflow* workflow);
+		void InvokeWorkflow(AbstractWorkflow* workflow);
 
 	public:
 		//==============================
@@ -140,6 +432,143 @@ namespace Galaxy::Core
 		 */
 		void SetCPUAffinity(const std::vector<unsigned int>& cpus);
 
+		/**
+		 * @brief 设置空闲策略
+		 * @param policy 空闲策略
+		 * @details 应当在执行器启动前设置。
+		 */
+		void SetIdlePolicy(const IdlePolicy& policy)
+		{
+			CurrentIdlePolicy = policy;
+		}
+
+		/**
+		 * @brief 获取空闲策略
+		 * @return 当前的空闲策略
+		 */
+		[[nodiscard]] const IdlePolicy& GetIdlePolicy() const
+		{
+			return CurrentIdlePolicy;
+		}
+
+		/**
+		 * @brief 设置调度选项
+		 * @param options 调度选项
+		 * @details 应当在执行器启动前设置。
+		 */
+		void SetSchedulingOptions(const SchedulingOptions& options)
+		{
+			CurrentSchedulingOptions = options;
+		}
+
+		/**
+		 * @brief 获取调度选项
+		 * @return 当前的调度选项
+		 */
+		[[nodiscard]] const SchedulingOptions& GetSchedulingOptions() const
+		{
+			return CurrentSchedulingOptions;
+		}
+
+		/**
+		 * @brief 查询调度选项是否未能完全生效
+		 * @retval true 至少有一个工作线程的调度选项因权限不足等原因未能生效
+		 * @retval false 所有工作线程的调度选项均已生效
+		 */
+		[[nodiscard]] bool IsSchedulingDegraded() const
+		{
+			return SchedulingDegraded;
+		}
+
+		/**
+		 * @brief 设置队列容量
+		 * @param capacity 排队任务数上限，为0时不限制
+		 * @param policy 队列已满时的处理策略
+		 * @details
+		 *  ~ 应当在执行器启动前设置。
+		 *  ~ 合并策略在容量为0时依然生效。
+		 */
+		void SetQueueCapacity(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::DropOldest)
+		{
+			QueueCapacity = capacity;
+			QueueOverflowPolicy = policy;
+		}
+
+		/**
+		 * @brief 获取队列容量
+		 * @return 排队任务数上限，为0时表示不限制
+		 */
+		[[nodiscard]] std::size_t GetQueueCapacity() const
+		{
+			return QueueCapacity;
+		}
+
+		/**
+		 * @brief 获取队列溢出策略
+		 * @return 当前的溢出策略
+		 */
+		[[nodiscard]] OverflowPolicy GetOverflowPolicy() const
+		{
+			return QueueOverflowPolicy;
+		}
+
+		/**
+		 * @brief 获取排队中的任务数
+		 * @return 排队中的任务数
+		 */
+		[[nodiscard]] std::size_t GetQueuedTasksCount() const
+		{
+			return QueuedTasksCount;
+		}
+
+		/**
+		 * @brief 获取队列统计
+		 * @return 自构造或上次重置以来的队列统计
+		 */
+		[[nodiscard]] QueueStatistics GetQueueStatistics() const;
+
+		/// 重置队列统计
+		void ResetQueueStatistics();
+
+		/**
+		 * @brief 设置连续直接执行的最大次数
+		 * @param max_hops 最大次数，为0时每个流处理器执行后都将重新提交
+		 * @details
+		 *  ~ 同一工作流的下一个流处理器仍在本执行器上时，将跳过提交直接执行。
+		 *  ~ 上限越大，排队开销越少，但其他工作流等待的时间可能越长。
+		 */
+		void SetMaxInlineHops(unsigned int max_hops)
+		{
+			MaxInlineHops = max_hops;
+		}
+
+		/**
+		 * @brief 获取连续直接执行的最大次数
+		 * @return 最大次数
+		 */
+		[[nodiscard]] unsigned int GetMaxInlineHops() const
+		{
+			return MaxInlineHops;
+		}
+
+		/**
+		 * @brief 获取被直接执行而省去的提交次数
+		 * @return 自构造以来省去的提交次数
+		 */
+		[[nodiscard]] std::uint64_t GetInlinedHopsCount() const
+		{
+			return InlinedHopsCount.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief 获取唤醒统计
+		 * @return 自启动或上次重置以来的唤醒统计
+		 */
+		[[nodiscard]] WakeUpStatistics GetWakeUpStatistics() const;
+
+		/// 重置唤醒统计
+		void ResetWakeUpStatistics();
+
 		//==============================
 		// 工作流交互部分
 		//==============================
@@ -148,9 +577,34 @@ namespace Galaxy::Core
 		 * @brief 提交工作流
 		 * @param workflow 将要被执行的工作流
 		 * @throw std::runtime_error 当工作流指针为空指针
+		 * @details
+		 *  ~ 任务队列使用工作流内嵌的链接节点，故工作流在被取出前不能再次提交。
 		 */
 		virtual void Submit(AbstractWorkflow* workflow);
 
+		/**
+		 * @brief 批量提交工作流
+		 * @param workflows 将要被执行的工作流列表
+		 * @throw std::runtime_error 当列表中存在空指针
+		 * @details
+		 *  ~ 默认逐个调用提交方法，派生类可以重载该方法以减少同步和唤醒的次数。
+		 */
+		virtual void SubmitBatch(const std::vector<AbstractWorkflow*>& workflows);
+
+		/**
+		 * @brief 并行执行循环
+		 * @param begin 起始下标
+		 * @param end 结束下标，不包含在内
+		 * @param body 循环体，参数为分得的子区间[起始, 结束)
+		 * @param grain_size 子区间的最小长度
+		 * @details
+		 *  ~ 供流处理器将自身的计算拆分到执行器所在的CPU上，返回时所有子区间均已执行完毕。
+		 *  ~ 默认在调用线程中以整个区间调用一次循环体，并行执行器将重载该方法。
+		 */
+		virtual void ParallelFor(std::size_t begin, std::size_t end,
+								 const std::function<void(std::size_t, std::size_t)>& body,
+								 std::size_t grain_size = 1);
+
 		/**
 		 * @brief 查询任务队列是否为空
 		 * @retval true 当任务队列为空
@@ -158,7 +612,7 @@ namespace Galaxy::Core
 		 */
 		[[nodiscard]] virtual bool IsEmpty() const
 		{
-			return Tasks.empty();
+			return Tasks.Empty();
 		}
 
 		//==============================
@@ -6,8 +6,8 @@
 namespace Galaxy::Core
 {
 	/// 构造函数
-	AbstractPort::AbstractPort(std::string  name, AbstractProcessor* host, bool optional) :
-			MappingName(std::move(name)), Optional(optional)
+	AbstractPort::AbstractPort(std::string  name, AbstractProcessor* host, bool optional, bool read_only) :
+			MappingName(std::move(name)), Optional(optional), ReadOnly(read_only)
 	{
 		Tools::ProcessorAccess::RegisterPort(host, this);
 	}
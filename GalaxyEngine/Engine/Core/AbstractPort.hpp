@@ -31,6 +31,8 @@ namespace Galaxy::Core
 		AbstractChannel* MountedChannel {nullptr};
 		/// 是否可选
 		bool Optional {false};
+		/// 是否只读
+		bool ReadOnly {false};
 
 	public:
 		/**
@@ -58,6 +60,18 @@ namespace Galaxy::Core
 		{
 			return Optional;
 		}
+
+		/**
+		 * @brief 获取当前端口是否为只读端口
+		 * @retval true 是只读的，流处理器只读取该通道
+		 * @retval false 流处理器可能写入该通道
+		 * @details
+		 *  ~ 只读声明用于推导流处理器之间的依赖关系，端口本身不会阻止写入。
+		 */
+		[[nodiscard]] bool IsReadOnly() const
+		{
+			return ReadOnly;
+		}
 	protected:
 		/**
 		 * @brief 获取挂载的通道
@@ -73,7 +87,9 @@ namespace Galaxy::Core
 		 * @brief 构造函数
 		 * @param name 自身名称，将挂载Session上的同名通道
 		 * @param host 宿主任务对象指针
+		 * @param optional 是否可选
+		 * @param read_only 是否只读
 		 */
-		AbstractPort(std::string name, AbstractProcessor* host, bool optional = false);
+		AbstractPort(std::string name, AbstractProcessor* host, bool optional = false, bool read_only = false);
 	};
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include "AbstractProcessor.hpp"
 #include "AbstractWorkflow.hpp"
+#include "AbstractExecutor.hpp"
+#include "AbstractAwaitable.hpp"
 #include "Tools/WorkflowAccess.hpp"
 
+#include <future>
+
 namespace Galaxy::Core
 {
 	/// 构造函数，用于自动注册
@@ -10,4 +14,67 @@ namespace Galaxy::Core
 	{
 		Tools::WorkflowAccess::RegisterProcessor(host, this, target_executor);
 	}
+
+	/// 以当前时刻作为帧的起点
+	void AbstractProcessor::StartFrameBudget() const
+	{
+		if (HostWorkflow && HostWorkflow->FrameBudget)
+		{
+			HostWorkflow->Deadline = std::chrono::steady_clock::now() + *HostWorkflow->FrameBudget;
+		}
+	}
+
+	/// 挂起宿主工作流，直至汇合
+	void AbstractProcessor::SuspendUntilJoined(std::size_t count, bool execute_again)
+	{
+		SuspendRequested = true;
+		RepeatRequested = execute_again;
+		Tools::WorkflowAccess::PrepareJoin(HostWorkflow, count);
+	}
+
+	/// 在可等待对象上挂起
+	bool AbstractProcessor::SuspendOn(AbstractAwaitable &awaitable, int resume_point)
+	{
+		if (awaitable.IsReady())
+		{
+			return false;
+		}
+
+		// 依赖图模式和流水线模式下无法挂起宿主工作流，只能在当前线程中等待
+		if (!Tools::WorkflowAccess::IsSuspendable(HostWorkflow))
+		{
+			std::promise<void> completion;
+			auto future = completion.get_future();
+			awaitable.Subscribe([&completion]{
+				completion.set_value();
+			});
+			future.wait();
+			return false;
+		}
+
+		ResumePoint = resume_point;
+		SuspendUntilJoined(1, true);
+		awaitable.Subscribe([workflow = HostWorkflow]{
+			if (auto next_executor = Tools::WorkflowAccess::Join(workflow))
+			{
+				(*next_executor)->Submit(workflow);
+			}
+		});
+		return true;
+	}
+
+	/// 在目标执行器上并行执行循环
+	void AbstractProcessor::ParallelFor(std::size_t begin, std::size_t end,
+										const std::function<void(std::size_t, std::size_t)> &body,
+										std::size_t grain_size) const
+	{
+		if (TargetExecutor && *TargetExecutor)
+		{
+			(*TargetExecutor)->ParallelFor(begin, end, body, grain_size);
+		}
+		else if (begin < end)
+		{
+			body(begin, end);
+		}
+	}
 }
\ No newline at end of file
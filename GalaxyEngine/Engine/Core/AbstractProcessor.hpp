@@ -2,6 +2,8 @@
 
 #include <tbb/tbb.h>
 #include <string>
+#include <functional>
+#include <cstddef>
 
 namespace Galaxy::Core
 {
@@ -11,6 +13,8 @@ namespace Galaxy::Core
 	class AbstractWorkflow;
 	/// 抽象执行器类
 	class AbstractExecutor;
+	/// 抽象可等待对象
+	class AbstractAwaitable;
 
 	namespace Tools
 	{
@@ -54,6 +58,72 @@ namespace Galaxy::Core
 		 */
 		bool StopWorkflowFlag {false};
 
+	private:
+		/// 是否请求了跳转
+		bool JumpRequested {false};
+		/// 跳转目标，为空时表示跳转至工作流末尾
+		AbstractProcessor* JumpTarget {nullptr};
+		/// 是否请求了挂起宿主工作流
+		bool SuspendRequested {false};
+		/// 汇合后是否重新执行本流处理器
+		bool RepeatRequested {false};
+		/// 恢复点，为0时表示从头开始执行
+		int ResumePoint {0};
+
+	protected:
+		/**
+		 * @brief 请求跳转
+		 * @param target 跳转目标，通常为标签；为空时将跳转至工作流末尾，正常结束本次迭代
+		 * @details
+		 *  ~ 本次执行结束后，工作流将从目标之后的流处理器继续执行，其间的流处理器将被跳过，不会发生执行器切换。
+		 *  ~ 目标位于当前流处理器之前时，将在本次迭代中重新执行其后的流处理器，不会触发开始和结束事件。
+		 *  ~ 流水线模式下只能向后跳转；依赖图模式下跳转请求将被忽略。
+		 */
+		void JumpTo(AbstractProcessor* target = nullptr)
+		{
+			JumpRequested = true;
+			JumpTarget = target;
+		}
+
+		/**
+		 * @brief 挂起宿主工作流，直至汇合
+		 * @param count 需要等待的汇合次数
+		 * @param execute_again 汇合后是否重新执行本流处理器，而非继续执行下一个流处理器
+		 * @details
+		 *  ~ 本次执行结束后，宿主工作流将被挂起，不占用执行器；其他任务对宿主工作流汇合count次后，
+		 *    将由最后一个汇合者从下一个流处理器继续执行，结束事件和循环设定均照常生效。
+		 *  ~ 汇合通过原子计数完成，不经过工作流等待区；须在启动需要汇合的任务之前调用。
+		 *  ~ 依赖图模式和流水线模式下不支持挂起。
+		 */
+		void SuspendUntilJoined(std::size_t count, bool execute_again = false);
+
+		/**
+		 * @brief 获取恢复点
+		 * @return 因等待而挂起时记录的恢复点；首次执行、或上次执行正常结束时为0
+		 * @details
+		 *  ~ 供AwaitBegin关键字使用，通常不需要直接调用。
+		 */
+		[[nodiscard]] int GetResumePoint() const
+		{
+			return ResumePoint;
+		}
+
+		/**
+		 * @brief 在可等待对象上挂起
+		 * @param awaitable 可等待对象
+		 * @param resume_point 恢复点，须为正数
+		 * @retval true 对象尚未就绪，宿主工作流将在本次执行结束后挂起，执行方法应当立即返回
+		 * @retval false 对象已经就绪，执行方法可以直接继续
+		 * @details
+		 *  ~ 供Await关键字使用，通常不需要直接调用。
+		 *  ~ 对象完成后，宿主工作流将被提交回本流处理器的执行器，并重新调用执行方法，
+		 *    执行方法可以通过恢复点跳转至等待之后继续执行。
+		 *  ~ 挂起期间局部变量不会被保留，需要跨越等待的状态应当存放在流处理器的成员中。
+		 *  ~ 工作流在挂起期间超时或被放弃时，下一次执行将从头开始。
+		 *  ~ 依赖图模式和流水线模式下无法挂起宿主工作流，将在当前线程中阻塞等待对象完成。
+		 */
+		bool SuspendOn(AbstractAwaitable& awaitable, int resume_point);
+
 		/**
 		 * @brief 获取目标执行器
 		 * @return 指向目标执行器的指针的指针，指向工作流中用于绑定执行器的指针的指针
@@ -74,6 +144,28 @@ namespace Galaxy::Core
 			return HostWorkflow;
 		}
 
+		/**
+		 * @brief 以当前时刻作为帧的起点
+		 * @details
+		 *  ~ 宿主工作流设置了帧时间预算时，将以当前时刻加上预算重新计算其截止期限。
+		 *  ~ 通常由采集数据的流处理器在取得帧数据后调用，从而使等待数据的时间不计入预算。
+		 *  ~ 流水线模式下只应由第一个阶段调用；依赖图模式下应由其他流处理器都依赖的流处理器调用。
+		 */
+		void StartFrameBudget() const;
+
+		/**
+		 * @brief 在目标执行器上并行执行循环
+		 * @param begin 起始下标
+		 * @param end 结束下标，不包含在内
+		 * @param body 循环体，参数为分得的子区间[起始, 结束)
+		 * @param grain_size 子区间的最小长度
+		 * @details
+		 *  ~ 循环将只在目标执行器所在的CPU上展开；未绑定执行器时，将在当前线程中串行执行。
+		 */
+		void ParallelFor(std::size_t begin, std::size_t end,
+						 const std::function<void(std::size_t, std::size_t)>& body,
+						 std::size_t grain_size = 1) const;
+
 		/**
 		 * @brief 默认构造函数
 		 * @details
@@ -3,12 +3,17 @@
 #include "AbstractPort.hpp"
 #include "AbstractChannel.hpp"
 #include "AbstractExecutor.hpp"
+#include "DependencyGraph.hpp"
+#include "FramePipeline.hpp"
 
 #include "Tools/ProcessorAccess.hpp"
 #include "Tools/PortAccess.hpp"
 
 #include "../Runtime.hpp"
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
 namespace Galaxy::Core
 {
@@ -16,6 +21,7 @@ namespace Galaxy::Core
 	AbstractWorkflow::AbstractWorkflow() : InitializeTask(&Runtime::GetInstance()->CurrentExecutorPointer, this)
 	{
 		NextProcessor = Processors.begin();
+		QueueLink.Owner = this;
 	}
 
 	/// 析构函数
@@ -26,16 +32,28 @@ namespace Galaxy::Core
 			OnFinalize();
 		}
 
+		// 未初始化的流处理器不需要终止化
+		if (!Initialized) return;
+
 		/// 遍历调用终止化方法
 		for (auto reverse_index = Processors.rbegin(); reverse_index!= Processors.rend(); ++reverse_index)
 		{
-			Tools::ProcessorAccess::InvokeInitialize(std::get<0>(*reverse_index));
+			Tools::ProcessorAccess::InvokeFinalize(std::get<0>(*reverse_index));
 		}
 	}
 
 	/// 初始化方法
 	void AbstractWorkflow::Initialize()
 	{
+		// 回收上次迭代在帧内存区中分配的内存
+		Arena.Reset();
+
+		// 以迭代开始的时刻作为默认的帧起点，开始事件中设置的截止期限将覆盖之
+		if (FrameBudget)
+		{
+			Deadline = std::chrono::steady_clock::now() + *FrameBudget;
+		}
+
 		// 调用用户的初始化方法
 		if (this->OnBegin)
 		{
@@ -55,11 +73,11 @@ namespace Galaxy::Core
 			// 遍历端口挂载
 			for (const auto& port : Tools::ProcessorAccess::GetPorts(processor))
 			{
-				auto finder = this->Channels.find(port->MappingName);
-				if (finder != this->Channels.end())
+				auto channel_id = ChannelNameTable::Find(port->MappingName);
+				if (auto* channel = channel_id ? FindChannel(*channel_id) : nullptr)
 				{
 					// 将端口挂载到通道
-					Tools::PortAccess::AttachToChannel(port, finder->second);
+					Tools::PortAccess::AttachToChannel(port, channel);
 				}
 				else if (!port->IsOptional())
 				{
@@ -70,6 +88,21 @@ namespace Galaxy::Core
 
 			Tools::ProcessorAccess::InvokeInitialize(processor);
 		}
+
+		// 端口均已挂载，可以推导依赖关系
+		if (UseDependencyGraph && !PipelineSlots.empty())
+		{
+			throw std::runtime_error("[AbstractWorkflow::Initialize] Dependency Graph and Pipeline Can Not Be Used Together.");
+		}
+		if (UseDependencyGraph)
+		{
+			Graph = std::make_unique<DependencyGraph>(this);
+		}
+		if (!PipelineSlots.empty())
+		{
+			Pipeline = std::make_unique<FramePipeline>(this, PipelineSlots);
+		}
+
 		// 将迭代器指向列表头部
 		NextProcessor = Processors.begin();
 		// 更新初始化状态
@@ -101,10 +134,66 @@ namespace Galaxy::Core
 			Tools::ProcessorAccess::ResetFlags(current_processor);
 		}
 
+		// 挂起后重新执行的流处理器将从其恢复点继续，其余情况均从头开始执行
+		if (!std::exchange(RepeatPending, false))
+		{
+			Tools::ProcessorAccess::ResetResumePoint(current_processor);
+		}
+
 		Tools::ProcessorAccess::InvokeExecute(current_processor);
 
 		++NextProcessor;
 
+		// 初始化完毕后，交由依赖图调度剩余的流处理器
+		if (Graph && current_processor == &InitializeTask)
+		{
+			return Graph->Launch();
+		}
+		// 初始化完毕后，交由帧流水线调度剩余的流处理器
+		if (Pipeline && current_processor == &InitializeTask)
+		{
+			return Pipeline->Launch();
+		}
+
+		// 跳过跳转目标之前的流处理器
+		if (auto jump_target = Tools::ProcessorAccess::TakeJumpRequest(current_processor))
+		{
+			NextProcessor = LocateJumpDestination(*jump_target);
+		}
+
+		// 挂起时，由最后一个汇合者继续本次迭代
+		if (auto execute_again = Tools::ProcessorAccess::TakeSuspendRequest(current_processor))
+		{
+			if (*execute_again)
+			{
+				NextProcessor = std::prev(NextProcessor);
+				RepeatPending = true;
+			}
+			if (!ArriveAtJoin())
+			{
+				return std::nullopt;
+			}
+		}
+
+		return ContinueIteration(stop_flag, pause_flag);
+	}
+
+	/// 完成一次汇合
+	bool AbstractWorkflow::ArriveAtJoin()
+	{
+		return PendingJoinsCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+	}
+
+	/// 继续本次迭代
+	std::optional<AbstractExecutor *> AbstractWorkflow::ContinueIteration(bool stop_flag, bool pause_flag)
+	{
+		// 超时的迭代不再执行剩余的流处理器
+		if (NextProcessor != Processors.end() && !stop_flag && !pause_flag && IsFrameExpired(Deadline))
+		{
+			ExpiredFramesCount.fetch_add(1, std::memory_order_relaxed);
+			return FinishIteration(true);
+		}
+
 		if (NextProcessor != Processors.end())
 		{
 			if (stop_flag)
@@ -122,43 +211,90 @@ namespace Galaxy::Core
 		// 若迭代已达末尾
 		else
 		{
-			// 将迭代器指向开头
-			NextProcessor = Processors.begin();
+			return FinishIteration(!pause_flag);
+		}
+		return {*std::get<1>(*NextProcessor)};
+	}
 
-			// 若设置了结束事件，则执行
-			if (OnEnd)
-			{
-				OnEnd();
-			}
+	/// 检查本次迭代是否已经超时
+	bool AbstractWorkflow::IsFrameExpired(const std::optional<std::chrono::steady_clock::time_point>& deadline) const
+	{
+		return FrameBudget && deadline && std::chrono::steady_clock::now() > *deadline;
+	}
 
-			// 判断是否允许终止
-			if (Loop && !pause_flag)
-			{
-				// 若设置了终止条件，则核验终止条件
-				if (LoopStopCondition)
-				{
-					if (LoopStopCondition())
-					{
-						// 满足终止条件，返回空
-						return std::nullopt;
-					}
-				}
+	/// 查找通道
+	AbstractChannel *AbstractWorkflow::FindChannel(ChannelID id) const
+	{
+		auto finder = Channels.find(id);
+		if (finder != Channels.end())
+		{
+			return finder->second;
+		}
+		return nullptr;
+	}
 
-				// 触发开始事件
-				if (OnBegin)
+	/// 查找跳转后需要执行的流处理器
+	auto AbstractWorkflow::LocateJumpDestination(AbstractProcessor *target) -> decltype(Processors)::iterator
+	{
+		if (!target)
+		{
+			return Processors.end();
+		}
+		auto finder = std::find_if(Processors.begin(), Processors.end(), [target](const auto& item){
+			return std::get<0>(item) == target;
+		});
+		if (finder == Processors.end())
+		{
+			throw std::runtime_error("[AbstractWorkflow::LocateJumpDestination] Jump Target is Not in This Workflow.");
+		}
+		return ++finder;
+	}
+
+	/// 结束本次迭代
+	std::optional<AbstractExecutor *> AbstractWorkflow::FinishIteration(bool allow_loop)
+	{
+		// 将迭代器指向开头
+		NextProcessor = Processors.begin();
+
+		// 若设置了结束事件，则执行
+		if (OnEnd)
+		{
+			OnEnd();
+		}
+
+		// 判断是否允许终止
+		if (Loop && allow_loop)
+		{
+			// 若设置了终止条件，则核验终止条件
+			if (LoopStopCondition)
+			{
+				if (LoopStopCondition())
 				{
-					OnBegin();
+					// 满足终止条件，返回空
+					return std::nullopt;
 				}
 			}
-			else
+
+			// 触发开始事件
+			if (OnBegin)
 			{
-				// 若未开启循环，则返回空
-				return std::nullopt;
+				OnBegin();
 			}
 		}
+		else
+		{
+			// 若未开启循环，则返回空
+			return std::nullopt;
+		}
 		return {*std::get<1>(*NextProcessor)};
 	}
 
+	/// 放弃本次迭代
+	std::optional<AbstractExecutor *> AbstractWorkflow::Abort()
+	{
+		return FinishIteration(true);
+	}
+
 	/// 流传出操作符
 	AbstractWorkflow &AbstractWorkflow::operator>>(AbstractExecutor *executor)
 	{
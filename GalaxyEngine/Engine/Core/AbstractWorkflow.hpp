@@ -6,8 +6,16 @@
 #include <tuple>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstdint>
 
 #include "../Processors/InitializeAction.hpp"
+#include "IntrusiveTaskQueue.hpp"
+#include "ChannelNameTable.hpp"
+#include "FrameArena.hpp"
 
 namespace Galaxy::Core
 {
@@ -17,6 +25,14 @@ namespace Galaxy::Core
 	class AbstractProcessor;
 	/// 抽象执行器类
 	class AbstractExecutor;
+	/// 依赖图
+	class DependencyGraph;
+	/// 依赖图分支
+	class DependencyBranch;
+	/// 帧流水线
+	class FramePipeline;
+	/// 流水线帧
+	class PipelineFrame;
 
 	namespace Tools
 	{
@@ -32,6 +48,10 @@ namespace Galaxy::Core
 	class AbstractWorkflow
 	{
 		friend class Tools::WorkflowAccess;
+		friend class DependencyGraph;
+		friend class DependencyBranch;
+		friend class FramePipeline;
+		friend class PipelineFrame;
 	private:
 		/**
 		 * @brief 是否已经初始化
@@ -40,13 +60,92 @@ namespace Galaxy::Core
 		 */
 		bool Initialized {false};
 
-		/// 通道映射表
-		tbb::concurrent_unordered_map<std::string, AbstractChannel*> Channels;
+		/**
+		 * @brief 通道映射表
+		 * @details
+		 *  ~ 以通道名称对应的编号为键，只在构造时写入。
+		 */
+		std::unordered_map<ChannelID, AbstractChannel*> Channels;
 		/// 流处理器列表
 		std::list<std::tuple<AbstractProcessor*, AbstractExecutor**>> Processors;
 		/// 下一个需要被执行的任务的处理器
 		decltype(Processors)::iterator NextProcessor {};
 
+		/**
+		 * @brief 是否已被取代
+		 * @details
+		 *  ~ 当执行器以合并策略管理队列时，排队中的工作流可能被同类型的新工作流取代，
+		 *    被取代的工作流出队时将被放弃执行。
+		 */
+		std::atomic_bool Superseded {false};
+
+		/**
+		 * @brief 任务链接节点
+		 * @details
+		 *  ~ 工作流在执行器的队列中排队时使用该节点，从而使提交不需要分配内存。
+		 */
+		TaskLink QueueLink {};
+
+		/**
+		 * @brief 是否允许被合并
+		 * @details
+		 *  ~ 依赖图分支的类型均相同，但对应不同的流处理器，故不允许被合并策略取代。
+		 */
+		bool Coalescable {true};
+
+		/**
+		 * @brief 依赖图
+		 * @details
+		 *  ~ 启用依赖图模式时，在初始化时根据端口挂载的通道构建。
+		 */
+		std::unique_ptr<DependencyGraph> Graph;
+
+		/**
+		 * @brief 帧流水线
+		 * @details
+		 *  ~ 设置了流水线通道组时，在初始化时根据端口挂载的通道构建。
+		 */
+		std::unique_ptr<FramePipeline> Pipeline;
+
+		/// 超时放弃的迭代数
+		std::atomic_size_t ExpiredFramesCount {0};
+
+		/**
+		 * @brief 挂起期间尚未完成的汇合次数
+		 * @details
+		 *  ~ 包含工作流自身的一次汇合，从而保证在迭代执行结束前不会被其他线程继续执行。
+		 */
+		std::atomic_size_t PendingJoinsCount {0};
+
+		/**
+		 * @brief 是否将重新执行挂起的流处理器
+		 * @details
+		 *  ~ 为true时，下一次执行的流处理器将从其恢复点继续；否则流处理器总是从头开始执行。
+		 */
+		bool RepeatPending {false};
+
+		/**
+		 * @brief 等待状态字
+		 * @details
+		 *  ~ 由工作流等待区使用，低位为等待状态，高位为已经完成的等待次数。
+		 */
+		std::atomic<std::uint64_t> WaitingStateWord {0};
+
+		/**
+		 * @brief 完成一次汇合
+		 * @retval true 为最后一个汇合者，应当继续本次迭代
+		 * @retval false 仍有尚未完成的汇合
+		 */
+		bool ArriveAtJoin();
+
+		/**
+		 * @brief 检查本次迭代是否已经超时
+		 * @param deadline 需要检查的截止期限
+		 * @retval true 设置了帧时间预算，且已超过截止期限
+		 * @retval false 未设置帧时间预算，或尚未超时
+		 */
+		[[nodiscard]] bool IsFrameExpired(const std::optional<std::chrono::steady_clock::time_point>& deadline) const;
+
 		//==============================
 		// 交互操作部分
 		//==============================
@@ -55,8 +154,53 @@ namespace Galaxy::Core
 		 * @brief 迭代执行
 		 * @throw std::runtime_error 当当前执行器为空或流处理器执行器为空
 		 * @return 可选，需要将该工作流传递给的执行器，若已达执行链末尾，则返回std::nullopt
+		 * @details
+		 *  ~ 依赖图模式下，初始化处理器执行完毕后将启动依赖图，工作流自身不再前往其他执行器。
+		 *  ~ 流水线模式下同理，初始化处理器执行完毕后将启动帧流水线。
+		 */
+		virtual std::optional<AbstractExecutor*> IterateExecute();
+
+		/**
+		 * @brief 继续本次迭代
+		 * @param stop_flag 刚执行的流处理器是否要求停止
+		 * @param pause_flag 刚执行的流处理器是否要求暂停
+		 * @return 可选，需要将该工作流传递给的执行器，若已达执行链末尾，则返回std::nullopt
+		 * @details
+		 *  ~ 在流处理器执行完毕且迭代器已指向下一个流处理器后调用，处理超时、停止、暂停和迭代结束。
+		 */
+		std::optional<AbstractExecutor*> ContinueIteration(bool stop_flag, bool pause_flag);
+
+		/**
+		 * @brief 查找通道
+		 * @param id 通道编号
+		 * @return 通道指针，若本工作流没有该通道，则返回空
+		 */
+		[[nodiscard]] AbstractChannel* FindChannel(ChannelID id) const;
+
+		/**
+		 * @brief 查找跳转后需要执行的流处理器
+		 * @param target 跳转目标，为空表示跳转至末尾
+		 * @throw std::runtime_error 当跳转目标不在本工作流中
+		 * @return 跳转目标之后的流处理器的迭代器
+		 */
+		decltype(Processors)::iterator LocateJumpDestination(AbstractProcessor* target);
+
+		/**
+		 * @brief 结束本次迭代
+		 * @param allow_loop 是否允许按照循环设定开始下一次迭代
+		 * @return 可选，下一次迭代的第一个执行器，若不再继续迭代，则返回std::nullopt
+		 * @details
+		 *  ~ 将迭代器指向开头并触发结束事件；若开启了循环且未满足停止条件，则触发开始事件。
 		 */
-		std::optional<AbstractExecutor*> IterateExecute();
+		std::optional<AbstractExecutor*> FinishIteration(bool allow_loop);
+
+		/**
+		 * @brief 放弃本次迭代
+		 * @return 可选，下一次迭代的第一个执行器，若不再继续迭代，则返回std::nullopt
+		 * @details
+		 *  ~ 剩余的流处理器将不会被执行，结束事件会被调用，随后按照循环设定决定是否重新开始。
+		 */
+		virtual std::optional<AbstractExecutor*> Abort();
 
 		/**
 		 * @brief 初始化任务
@@ -117,6 +261,75 @@ namespace Galaxy::Core
 		 */
 		std::function<bool()> LoopStopCondition {};
 
+		/**
+		 * @brief 调度优先级
+		 * @details
+		 *  ~ 数值越大越优先，仅对按优先级调度的执行器生效，例如截止期限执行器。
+		 */
+		int Priority {0};
+		/**
+		 * @brief 绝对截止期限
+		 * @details
+		 *  ~ 为空时表示没有截止期限；截止期限执行器将在同一优先级中优先执行截止期限最早的工作流。
+		 *  ~ 通常在开始事件中设置为帧的采集时间加上时间预算，每次提交时读取该值。
+		 */
+		std::optional<std::chrono::steady_clock::time_point> Deadline {};
+
+		/**
+		 * @brief 帧时间预算
+		 * @details
+		 *  ~ 为空时表示不限制每次迭代的耗时。
+		 *  ~ 设置后，每次迭代开始时、开始事件之前，截止期限将被设置为当前时刻加上预算，开始事件可以覆盖之；流处理器也可以在取得帧数据后调用StartFrameBudget方法，
+		 *    以帧的采集时刻重新计算截止期限。
+		 *  ~ 工作流在流处理器之间检查截止期限，超时的迭代将跳过剩余的流处理器，触发结束事件，并按照循环设定开始下一次迭代。
+		 */
+		std::optional<std::chrono::steady_clock::duration> FrameBudget {};
+
+		/**
+		 * @brief 获取超时放弃的迭代数
+		 * @return 自工作流构造以来，因超出帧时间预算而被放弃的迭代数
+		 */
+		[[nodiscard]] std::size_t GetExpiredFramesCount() const
+		{
+			return ExpiredFramesCount.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief 帧内存区
+		 * @details
+		 *  ~ 每次迭代开始时、开始事件触发之前重置，供帧通道中的容器在迭代期间分配内存。
+		 *  ~ 流水线模式下每帧使用其通道组所属工作流的内存区，在该帧进入第一个阶段时重置。
+		 *  ~ 依赖图模式下互不依赖的流处理器会同时执行，不应通过内存区分配内存。
+		 */
+		FrameArena Arena {};
+
+		/**
+		 * @brief 是否启用依赖图模式
+		 * @details
+		 *  ~ 需要在工作流首次执行前设置。
+		 *  ~ 启用后，初始化时将根据各流处理器端口挂载的通道推导依赖关系：访问同一通道且至少一方可能写入的两个流处理器，
+		 *    按照声明顺序先后执行；互不依赖的流处理器将同时在各自的执行器上执行，所有前驱执行完毕后才执行后继。
+		 *  ~ 没有挂载任何端口的流处理器无法推导依赖关系，将作为屏障，与其前后所有流处理器保持声明顺序。
+		 *  ~ 流处理器要求停止时，尚未开始的流处理器将被跳过，随后触发结束事件且不再循环；
+		 *    要求暂停时，尚未开始的流处理器同样被跳过，但不触发结束事件，再次提交时将重新开始一次迭代。
+		 *  ~ 等待动作等会自行提交宿主工作流的流处理器不适用于该模式。
+		 */
+		bool UseDependencyGraph {false};
+
+		/**
+		 * @brief 流水线通道组
+		 * @details
+		 *  ~ 需要在工作流首次执行前设置，且不能与依赖图模式同时启用。
+		 *  ~ 列表中的工作流须与本工作流类型相同，仅作为额外的通道组使用，不应被提交或执行；
+		 *    非空时，本工作流将以流水线方式执行，最多同时处理列表长度加一帧，每帧使用一组通道。
+		 *  ~ 各流处理器仍然只有一份，每个流处理器同一时刻只处理一帧，且处理帧的顺序与帧开始的顺序相同，
+		 *    故第一帧的后段阶段可以与第二帧的前段阶段同时执行，而输出顺序保持不变。
+		 *  ~ 开始事件与结束事件将按照帧的顺序分别触发，但某一帧的开始事件可能与更早帧的结束事件同时执行。
+		 *  ~ 流处理器要求停止或暂停时，该帧剩余的流处理器将被跳过，且不再开始新的帧，已经开始的帧仍会执行完毕。
+		 *  ~ 等待动作等会自行提交宿主工作流的流处理器不适用于该模式。
+		 */
+		std::vector<AbstractWorkflow*> PipelineSlots {};
+
 		/**
 		 * @brief 构造函数
 		 * @details
@@ -125,7 +338,7 @@ namespace Galaxy::Core
 		AbstractWorkflow();
 
 		/// 析构函数
-		~AbstractWorkflow();
+		virtual ~AbstractWorkflow();
 
 		//==============================
 		// 操作符重载部分
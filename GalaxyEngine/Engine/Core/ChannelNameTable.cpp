@@ -0,0 +1,78 @@
+#include "ChannelNameTable.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace Galaxy::Core
+{
+	namespace
+	{
+		/// 名称表存储
+		struct NameTableStorage
+		{
+			/// 读写锁
+			std::shared_mutex Mutex;
+			/// 名称到编号的映射
+			std::unordered_map<std::string, ChannelID> IDs;
+			/// 按编号排列的名称
+			std::vector<std::string> Names;
+		};
+
+		/// 获取名称表存储，使用局部静态变量以免静态初始化顺序问题
+		NameTableStorage& GetStorage()
+		{
+			static NameTableStorage storage;
+			return storage;
+		}
+	}
+
+	/// 获取名称对应的编号
+	ChannelID ChannelNameTable::Intern(const std::string &name)
+	{
+		auto& storage = GetStorage();
+		{
+			std::shared_lock lock(storage.Mutex);
+			auto finder = storage.IDs.find(name);
+			if (finder != storage.IDs.end())
+			{
+				return finder->second;
+			}
+		}
+
+		std::unique_lock lock(storage.Mutex);
+		auto [iterator, inserted] = storage.IDs.emplace(name, static_cast<ChannelID>(storage.Names.size()));
+		if (inserted)
+		{
+			storage.Names.push_back(name);
+		}
+		return iterator->second;
+	}
+
+	/// 查找名称对应的编号
+	std::optional<ChannelID> ChannelNameTable::Find(const std::string &name)
+	{
+		auto& storage = GetStorage();
+		std::shared_lock lock(storage.Mutex);
+		auto finder = storage.IDs.find(name);
+		if (finder != storage.IDs.end())
+		{
+			return finder->second;
+		}
+		return std::nullopt;
+	}
+
+	/// 获取编号对应的名称
+	std::string ChannelNameTable::GetName(ChannelID id)
+	{
+		auto& storage = GetStorage();
+		std::shared_lock lock(storage.Mutex);
+		if (id >= storage.Names.size())
+		{
+			throw std::runtime_error("[ChannelNameTable::GetName] Channel ID is Not Allocated.");
+		}
+		return storage.Names[id];
+	}
+}
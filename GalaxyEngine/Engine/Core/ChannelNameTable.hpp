@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace Galaxy::Core
+{
+	/// 通道编号
+	using ChannelID = std::uint32_t;
+
+	/**
+	 * @brief 通道名称表
+	 * @author Vincent
+	 * @details
+	 *  ~ 通道名称在注册和挂载时被转换为进程内唯一的整数编号，相同的名称总是对应相同的编号，
+	 *    工作流以编号而非字符串索引通道。
+	 *  ~ 名称只在注册和初始化时查询，执行期间不应调用该类的方法。
+	 */
+	class ChannelNameTable
+	{
+	public:
+		/**
+		 * @brief 获取名称对应的编号
+		 * @param name 通道名称
+		 * @return 通道编号，名称首次出现时将为其分配新的编号
+		 */
+		static ChannelID Intern(const std::string& name);
+
+		/**
+		 * @brief 查找名称对应的编号
+		 * @param name 通道名称
+		 * @return 通道编号，名称从未出现过时返回std::nullopt，不会为其分配编号
+		 */
+		static std::optional<ChannelID> Find(const std::string& name);
+
+		/**
+		 * @brief 获取编号对应的名称
+		 * @param id 通道编号
+		 * @throw std::runtime_error 当编号未被分配
+		 * @return 通道名称
+		 */
+		static std::string GetName(ChannelID id);
+	};
+}
@@ -0,0 +1,237 @@
+#include "DependencyGraph.hpp"
+#include "AbstractExecutor.hpp"
+#include "AbstractPort.hpp"
+
+#include "Tools/ProcessorAccess.hpp"
+#include "Tools/PortAccess.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Galaxy::Core
+{
+	//==============================
+	// 依赖图分支部分
+	//==============================
+
+	/// 构造函数
+	DependencyBranch::DependencyBranch(DependencyGraph *graph, std::size_t node_index,
+									   AbstractProcessor *processor, AbstractExecutor **executor) :
+		Graph(graph), NodeIndex(node_index)
+	{
+		// 分支只包含对应的流处理器，使执行器可以正常查询其将要执行的流处理器
+		Processors.clear();
+		Processors.emplace_back(processor, executor);
+		NextProcessor = Processors.begin();
+		Initialized = true;
+		Coalescable = false;
+	}
+
+	/// 析构函数
+	DependencyBranch::~DependencyBranch()
+	{
+		Processors.clear();
+	}
+
+	/// 执行对应的流处理器
+	std::optional<AbstractExecutor *> DependencyBranch::IterateExecute()
+	{
+		auto [processor, executor] = Processors.front();
+
+		bool stop_flag = Tools::ProcessorAccess::IsStopFlagOn(processor);
+		bool pause_flag = Tools::ProcessorAccess::IsPauseFlagOn(processor);
+		if (stop_flag || pause_flag)
+		{
+			Tools::ProcessorAccess::ResetFlags(processor);
+		}
+
+		Tools::ProcessorAccess::InvokeExecute(processor);
+		// 依赖图模式下没有确定的后续流处理器，跳转请求将被忽略
+		Tools::ProcessorAccess::TakeJumpRequest(processor);
+		if (Tools::ProcessorAccess::TakeSuspendRequest(processor))
+		{
+			throw std::runtime_error("[DependencyBranch::IterateExecute] Suspending is Not Supported in Dependency Graph Mode.");
+		}
+
+		Graph->Complete(NodeIndex, stop_flag, pause_flag, false);
+		return std::nullopt;
+	}
+
+	/// 放弃执行
+	std::optional<AbstractExecutor *> DependencyBranch::Abort()
+	{
+		Graph->Complete(NodeIndex, false, false, true);
+		return std::nullopt;
+	}
+
+	//==============================
+	// 依赖图部分
+	//==============================
+
+	/// 构造函数
+	DependencyGraph::DependencyGraph(AbstractWorkflow *host) : Host(host)
+	{
+		// 每个节点访问的通道，以及是否可能写入
+		std::vector<std::vector<std::pair<AbstractChannel*, bool>>> accesses;
+
+		for (const auto& [processor, executor] : Host->Processors)
+		{
+			if (processor == &Host->InitializeTask) continue;
+
+			auto node = std::make_unique<Node>();
+			node->Processor = processor;
+			node->Executor = executor;
+			node->Branch = std::make_unique<DependencyBranch>(this, Nodes.size(), processor, executor);
+			Nodes.push_back(std::move(node));
+
+			auto& node_accesses = accesses.emplace_back();
+			for (const auto& port : Tools::ProcessorAccess::GetPorts(processor))
+			{
+				if (auto* channel = Tools::PortAccess::GetChannel(port))
+				{
+					node_accesses.emplace_back(channel, !port->IsReadOnly());
+				}
+			}
+		}
+
+		for (std::size_t later = 0; later < Nodes.size(); ++later)
+		{
+			for (std::size_t earlier = 0; earlier < later; ++earlier)
+			{
+				bool dependent = accesses[earlier].empty() || accesses[later].empty();
+				for (auto first = accesses[earlier].begin(); !dependent && first != accesses[earlier].end(); ++first)
+				{
+					for (const auto& second : accesses[later])
+					{
+						if (first->first == second.first && (first->second || second.second))
+						{
+							dependent = true;
+							break;
+						}
+					}
+				}
+
+				if (dependent)
+				{
+					Nodes[earlier]->Successors.push_back(later);
+					++Nodes[later]->PredecessorsCount;
+				}
+			}
+
+			if (Nodes[later]->PredecessorsCount == 0)
+			{
+				Roots.push_back(later);
+			}
+		}
+	}
+
+	/// 启动一次迭代
+	std::optional<AbstractExecutor *> DependencyGraph::Launch()
+	{
+		if (Nodes.empty())
+		{
+			return Host->FinishIteration(true);
+		}
+
+		for (auto& node : Nodes)
+		{
+			node->PendingPredecessors.store(node->PredecessorsCount, std::memory_order_relaxed);
+			node->Branch->Priority = Host->Priority;
+			node->Branch->Deadline = Host->Deadline;
+		}
+		StopRequested = false;
+		PauseRequested = false;
+		AbortRequested = false;
+		Expired = false;
+		RemainingNodes.store(Nodes.size());
+
+		// 最后一个根节点提交后，本次迭代可能随时结束，此后不能再访问迭代状态
+		for (auto index : Roots)
+		{
+			Dispatch(index);
+		}
+		return std::nullopt;
+	}
+
+	/// 调度节点
+	void DependencyGraph::Dispatch(std::size_t index)
+	{
+		auto& node = *Nodes[index];
+
+		if (StopRequested || PauseRequested || AbortRequested || Expired)
+		{
+			Complete(index, false, false, false);
+			return;
+		}
+
+		// 前驱完成时才检查截止期限，截止期限由前驱写入宿主工作流
+		if (node.PredecessorsCount > 0 && Host->IsFrameExpired(Host->Deadline))
+		{
+			if (!Expired.exchange(true))
+			{
+				Host->ExpiredFramesCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			Complete(index, false, false, false);
+			return;
+		}
+
+		if (!node.Executor)
+		{
+			throw std::runtime_error("[DependencyGraph::Dispatch] Executor Pointer Reference is Null.");
+		}
+		if (!*node.Executor)
+		{
+			throw std::runtime_error("[DependencyGraph::Dispatch] Executor Pointer is Null.");
+		}
+		(*node.Executor)->Submit(node.Branch.get());
+	}
+
+	/// 完成节点
+	void DependencyGraph::Complete(std::size_t index, bool stop, bool pause, bool aborted)
+	{
+		if (stop) StopRequested = true;
+		if (pause) PauseRequested = true;
+		if (aborted) AbortRequested = true;
+
+		for (auto successor : Nodes[index]->Successors)
+		{
+			if (Nodes[successor]->PendingPredecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Dispatch(successor);
+			}
+		}
+
+		if (RemainingNodes.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			FinishIteration();
+		}
+	}
+
+	/// 结束宿主工作流的本次迭代
+	void DependencyGraph::FinishIteration()
+	{
+		std::optional<AbstractExecutor*> next_executor;
+		if (AbortRequested)
+		{
+			// 与放弃顺序执行的工作流相同
+			next_executor = Host->FinishIteration(true);
+		}
+		else if (StopRequested)
+		{
+			next_executor = Host->FinishIteration(false);
+		}
+		else if (PauseRequested)
+		{
+			Host->NextProcessor = Host->Processors.begin();
+		}
+		else
+		{
+			next_executor = Host->FinishIteration(true);
+		}
+
+		if (next_executor && *next_executor)
+		{
+			(*next_executor)->Submit(Host);
+		}
+	}
+}
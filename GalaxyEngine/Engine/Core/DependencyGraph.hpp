@@ -0,0 +1,164 @@
+#pragma once
+
+#include "AbstractWorkflow.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Galaxy::Core
+{
+	/// 流处理器接口
+	class AbstractProcessor;
+	/// 抽象执行器类
+	class AbstractExecutor;
+
+	/**
+	 * @brief 依赖图分支
+	 * @author Vincent
+	 * @details
+	 *  ~ 依赖图中的每个流处理器对应一个分支，分支作为独立的工作流被提交到该流处理器的执行器上，
+	 *    从而使互不依赖的流处理器可以同时在各自的执行器上执行。
+	 *  ~ 分支只执行对应的一个流处理器，执行完毕或被执行器放弃后通知所属的依赖图。
+	 */
+	class DependencyBranch : public AbstractWorkflow
+	{
+	private:
+		/// 所属的依赖图
+		DependencyGraph* Graph;
+		/// 对应的节点编号
+		std::size_t NodeIndex;
+
+		/// 执行对应的流处理器，并通知依赖图
+		std::optional<AbstractExecutor*> IterateExecute() override;
+
+		/// 不执行流处理器，并通知依赖图放弃本次迭代
+		std::optional<AbstractExecutor*> Abort() override;
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param graph 所属的依赖图
+		 * @param node_index 节点编号
+		 * @param processor 对应的流处理器
+		 * @param executor 存放流处理器执行器指针的指针
+		 */
+		DependencyBranch(DependencyGraph* graph, std::size_t node_index,
+						 AbstractProcessor* processor, AbstractExecutor** executor);
+
+		/// 析构函数，流处理器属于宿主工作流，不应由分支终止化
+		~DependencyBranch() override;
+	};
+
+	/**
+	 * @brief 依赖图
+	 * @author Vincent
+	 * @details
+	 *  ~ 根据流处理器端口挂载的通道推导流处理器之间的依赖关系，并在每次迭代中按照依赖关系调度流处理器。
+	 *  ~ 声明在前的流处理器与声明在后的流处理器访问同一通道，且至少一方的端口不是只读端口时，后者依赖于前者。
+	 *  ~ 没有挂载任何端口的流处理器作为屏障，依赖于其前所有流处理器，并被其后所有流处理器依赖。
+	 *  ~ 最后一个完成的流处理器所在的线程将结束宿主工作流的本次迭代。
+	 */
+	class DependencyGraph
+	{
+		friend class DependencyBranch;
+
+	private:
+		/// 依赖图节点
+		struct Node
+		{
+			/// 流处理器
+			AbstractProcessor* Processor {nullptr};
+			/// 存放执行器指针的指针
+			AbstractExecutor** Executor {nullptr};
+			/// 后继节点编号列表
+			std::vector<std::size_t> Successors;
+			/// 前驱节点数量
+			std::size_t PredecessorsCount {0};
+			/// 本次迭代中尚未完成的前驱节点数量
+			std::atomic_size_t PendingPredecessors {0};
+			/// 对应的分支
+			std::unique_ptr<DependencyBranch> Branch;
+		};
+
+		/// 宿主工作流
+		AbstractWorkflow* Host;
+		/// 节点列表，按照声明顺序排列
+		std::vector<std::unique_ptr<Node>> Nodes;
+		/// 没有前驱的节点编号列表
+		std::vector<std::size_t> Roots;
+
+		/// 本次迭代中尚未完成的节点数量
+		std::atomic_size_t RemainingNodes {0};
+		/// 本次迭代中是否有流处理器要求停止
+		std::atomic_bool StopRequested {false};
+		/// 本次迭代中是否有流处理器要求暂停
+		std::atomic_bool PauseRequested {false};
+		/// 本次迭代中是否有分支被执行器放弃
+		std::atomic_bool AbortRequested {false};
+		/// 本次迭代是否已经超出帧时间预算
+		std::atomic_bool Expired {false};
+
+		/**
+		 * @brief 调度节点
+		 * @param index 节点编号
+		 * @throw std::runtime_error 当流处理器的执行器为空
+		 * @details
+		 *  ~ 本次迭代已被中断或已超出帧时间预算时，将直接以完成的方式跳过该节点。
+		 */
+		void Dispatch(std::size_t index);
+
+		/**
+		 * @brief 完成节点
+		 * @param index 节点编号
+		 * @param stop 流处理器是否要求停止
+		 * @param pause 流处理器是否要求暂停
+		 * @param aborted 分支是否被执行器放弃
+		 * @details
+		 *  ~ 将调度所有前驱均已完成的后继节点；若所有节点均已完成，则结束宿主工作流的本次迭代。
+		 */
+		void Complete(std::size_t index, bool stop, bool pause, bool aborted);
+
+		/// 结束宿主工作流的本次迭代，并按照循环设定提交下一次迭代
+		void FinishIteration();
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param host 宿主工作流，其端口须已挂载
+		 * @details
+		 *  ~ 将为宿主工作流中除初始化处理器以外的每个流处理器创建节点和分支。
+		 */
+		explicit DependencyGraph(AbstractWorkflow* host);
+
+		DependencyGraph(const DependencyGraph&) = delete;
+		DependencyGraph& operator=(const DependencyGraph&) = delete;
+
+		/**
+		 * @brief 启动一次迭代
+		 * @return 可选，宿主工作流需要前往的执行器；节点均已提交时返回std::nullopt
+		 * @details
+		 *  ~ 所有分支将继承宿主工作流的优先级和截止期限。
+		 */
+		std::optional<AbstractExecutor*> Launch();
+
+		/**
+		 * @brief 获取节点数量
+		 * @return 参与调度的流处理器数量
+		 */
+		[[nodiscard]] std::size_t GetNodesCount() const
+		{
+			return Nodes.size();
+		}
+
+		/**
+		 * @brief 获取可以同时开始的节点数量
+		 * @return 没有前驱的流处理器数量
+		 */
+		[[nodiscard]] std::size_t GetRootsCount() const
+		{
+			return Roots.size();
+		}
+	};
+}
@@ -0,0 +1,59 @@
+#include "FrameArena.hpp"
+
+namespace Galaxy::Core
+{
+	/// 分配内存
+	void *FrameArena::OverflowResource::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		OverflowBytes += bytes;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	/// 释放内存
+	void FrameArena::OverflowResource::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment)
+	{
+		std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+	}
+
+	/// 判断资源是否相同
+	bool FrameArena::OverflowResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+	{
+		return this == &other;
+	}
+
+	/// 构造函数
+	FrameArena::FrameArena(std::size_t initial_size) :
+		Block(new std::byte[initial_size]), BlockSize(initial_size)
+	{
+		Resource.emplace(Block.get(), BlockSize, &Overflow);
+	}
+
+	/// 订阅重置事件
+	void FrameArena::Subscribe(std::function<void()> handler)
+	{
+		ResetHandlers.push_back(std::move(handler));
+	}
+
+	/// 重置内存区
+	void FrameArena::Reset()
+	{
+		// 先使持有者放弃内存，再回收
+		for (auto& handler : ResetHandlers)
+		{
+			handler();
+		}
+
+		if (Overflow.OverflowBytes == 0)
+		{
+			Resource->release();
+			return;
+		}
+
+		// 上次迭代借用过内存，将连续内存扩大至足以容纳上次迭代的所有分配
+		Resource.reset();
+		BlockSize = (BlockSize + Overflow.OverflowBytes) * 2;
+		Overflow.OverflowBytes = 0;
+		Block.reset(new std::byte[BlockSize]);
+		Resource.emplace(Block.get(), BlockSize, &Overflow);
+	}
+}
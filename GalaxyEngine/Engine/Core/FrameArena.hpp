@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory_resource>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <cstddef>
+
+namespace Galaxy::Core
+{
+	/**
+	 * @brief 帧内存区
+	 * @author Vincent
+	 * @details
+	 *  ~ 每个工作流持有一个帧内存区，在每次迭代开始时重置，供通道中的容器在迭代期间分配内存。
+	 *  ~ 内存区以单调缓冲资源实现：分配只移动指针，释放不做任何操作，重置时一次性回收所有内存，与分配的次数无关。
+	 *  ~ 内存区预先持有一块连续的内存；某次迭代用尽该内存时将向默认资源借用，并在下次重置时扩大连续内存，
+	 *    故稳态下每次迭代的所有分配都落在同一块内存上。
+	 *  ~ 连续内存不做初始化，未被使用的部分不占用物理内存，故不使用帧通道的工作流几乎没有额外开销。
+	 *  ~ 内存区不是线程安全的，只应在同一时刻只有一个流处理器执行的工作流中使用。
+	 */
+	class FrameArena
+	{
+	private:
+		/**
+		 * @brief 溢出资源
+		 * @details
+		 *  ~ 连续内存用尽时单调缓冲资源将向其借用内存，该资源将借用转发给默认资源，并记录借用的字节数。
+		 */
+		class OverflowResource : public std::pmr::memory_resource
+		{
+		public:
+			/// 自上次重置以来借用的字节数
+			std::size_t OverflowBytes {0};
+
+		protected:
+			/// 分配内存
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+			/// 释放内存
+			void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+			/// 判断资源是否相同
+			[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+		};
+
+		/// 溢出资源
+		OverflowResource Overflow {};
+		/// 连续内存
+		std::unique_ptr<std::byte[]> Block {};
+		/// 连续内存的大小
+		std::size_t BlockSize;
+		/// 单调缓冲资源，扩大连续内存时原地重新构造，从而使资源的地址保持不变
+		std::optional<std::pmr::monotonic_buffer_resource> Resource {};
+
+		/// 重置事件列表
+		std::vector<std::function<void()>> ResetHandlers {};
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param initial_size 连续内存的初始大小，单位为字节
+		 */
+		explicit FrameArena(std::size_t initial_size = 256 * 1024);
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/**
+		 * @brief 获取内存资源
+		 * @return 内存资源的指针，在内存区的生命周期内保持不变
+		 */
+		[[nodiscard]] std::pmr::memory_resource* GetResource()
+		{
+			return &*Resource;
+		}
+
+		/**
+		 * @brief 获取连续内存的大小
+		 * @return 连续内存的大小，单位为字节
+		 */
+		[[nodiscard]] std::size_t GetCapacity() const
+		{
+			return BlockSize;
+		}
+
+		/**
+		 * @brief 订阅重置事件
+		 * @param handler 事件处理函数器
+		 * @details
+		 *  ~ 重置事件在回收内存之前触发，持有内存区中内存的对象须在其中放弃这些内存，例如将容器重新构造为空容器。
+		 *  ~ 应当在工作流首次执行前订阅，通常由通道在构造时订阅。
+		 */
+		void Subscribe(std::function<void()> handler);
+
+		/**
+		 * @brief 重置内存区
+		 * @details
+		 *  ~ 将触发重置事件，随后回收所有内存；上次迭代借用过内存时，连续内存将被扩大。
+		 *  ~ 由工作流在每次迭代开始时调用，通常不需要手动调用。
+		 */
+		void Reset();
+	};
+}
@@ -0,0 +1,355 @@
+#include "FramePipeline.hpp"
+#include "AbstractExecutor.hpp"
+#include "AbstractPort.hpp"
+
+#include "Tools/ProcessorAccess.hpp"
+#include "Tools/PortAccess.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <typeinfo>
+
+namespace Galaxy::Core
+{
+	//==============================
+	// 流水线帧部分
+	//==============================
+
+	/// 构造函数
+	PipelineFrame::PipelineFrame(FramePipeline *pipeline, std::size_t slot_index,
+								 const std::vector<std::tuple<AbstractProcessor *, AbstractExecutor **>> &stages) :
+		Pipeline(pipeline), SlotIndex(slot_index)
+	{
+		// 流水线帧包含所有阶段，使执行器可以正常查询其将要执行的流处理器
+		Processors.assign(stages.begin(), stages.end());
+		NextProcessor = Processors.begin();
+		Initialized = true;
+		Coalescable = false;
+	}
+
+	/// 析构函数
+	PipelineFrame::~PipelineFrame()
+	{
+		Processors.clear();
+	}
+
+	/// 执行当前阶段的流处理器
+	std::optional<AbstractExecutor *> PipelineFrame::IterateExecute()
+	{
+		auto* host = Pipeline->Host;
+		auto& stage = *Pipeline->Stages[StageIndex];
+
+		if (StageIndex == 0 && FrameIndex != Pipeline->LaunchFrameIndex)
+		{
+			// 回收本通道组上一帧在帧内存区中分配的内存
+			Pipeline->SlotWorkflows[SlotIndex]->Arena.Reset();
+			if (host->FrameBudget)
+			{
+				host->Deadline = std::chrono::steady_clock::now() + *host->FrameBudget;
+			}
+			if (host->OnBegin)
+			{
+				host->OnBegin();
+			}
+		}
+
+		// 每个阶段同一时刻只处理一帧，故可以安全地将端口挂载到本帧的通道组
+		for (const auto& [port, channels] : stage.Bindings)
+		{
+			Tools::PortAccess::AttachToChannel(port, channels[SlotIndex]);
+		}
+
+		bool stop_flag = Tools::ProcessorAccess::IsStopFlagOn(stage.Processor);
+		bool pause_flag = Tools::ProcessorAccess::IsPauseFlagOn(stage.Processor);
+		if (stop_flag || pause_flag)
+		{
+			Tools::ProcessorAccess::ResetFlags(stage.Processor);
+		}
+
+		Tools::ProcessorAccess::InvokeExecute(stage.Processor);
+
+		// 第一个阶段同一时刻只处理一帧，故可以在其执行完毕后安全地读取宿主的调度参数，包括该阶段重新计算的截止期限
+		if (StageIndex == 0)
+		{
+			Priority = host->Priority;
+			Deadline = host->Deadline;
+		}
+
+		if (Tools::ProcessorAccess::TakeSuspendRequest(stage.Processor))
+		{
+			throw std::runtime_error("[PipelineFrame::IterateExecute] Suspending is Not Supported in Pipeline Mode.");
+		}
+		if (auto jump_target = Tools::ProcessorAccess::TakeJumpRequest(stage.Processor))
+		{
+			Pipeline->SkipFrame(this, *jump_target);
+		}
+
+		if (stop_flag || pause_flag)
+		{
+			Pipeline->Stopping = true;
+			Pipeline->SkipFrame(this, nullptr);
+			EndSuppressed = !stop_flag;
+		}
+		else if (!Skipping && StageIndex + 1 < Pipeline->Stages.size() && host->IsFrameExpired(Deadline))
+		{
+			// 超时的帧跳过剩余的阶段，但仍会触发结束事件
+			host->ExpiredFramesCount.fetch_add(1, std::memory_order_relaxed);
+			Pipeline->SkipFrame(this, nullptr);
+		}
+
+		return Pipeline->Advance(this);
+	}
+
+	/// 跳过本帧剩余的阶段
+	std::optional<AbstractExecutor *> PipelineFrame::Abort()
+	{
+		Pipeline->SkipFrame(this, nullptr);
+		return Pipeline->Advance(this);
+	}
+
+	//==============================
+	// 帧流水线部分
+	//==============================
+
+	/// 构造函数
+	FramePipeline::FramePipeline(AbstractWorkflow *host, const std::vector<AbstractWorkflow *> &slots) : Host(host)
+	{
+		for (auto* slot : slots)
+		{
+			if (!slot || typeid(*slot) != typeid(*host))
+			{
+				throw std::runtime_error("[FramePipeline::FramePipeline] Pipeline Slot Workflow Type Mismatches.");
+			}
+		}
+
+		std::vector<std::tuple<AbstractProcessor*, AbstractExecutor**>> stages;
+		for (const auto& [processor, executor] : Host->Processors)
+		{
+			if (processor == &Host->InitializeTask) continue;
+			stages.emplace_back(processor, executor);
+
+			auto stage = std::make_unique<Stage>();
+			stage->Processor = processor;
+			stage->Executor = executor;
+
+			for (const auto& port : Tools::ProcessorAccess::GetPorts(processor))
+			{
+				// 第0组通道即宿主工作流的通道，端口已在初始化时挂载
+				std::vector<AbstractChannel*> channels {Tools::PortAccess::GetChannel(port)};
+				auto channel_id = ChannelNameTable::Find(port->MappingName);
+				for (auto* slot : slots)
+				{
+					if (auto* channel = channel_id ? slot->FindChannel(*channel_id) : nullptr)
+					{
+						channels.push_back(channel);
+					}
+					else if (!port->IsOptional())
+					{
+						throw std::runtime_error("[FramePipeline::FramePipeline] A Channel Named " +
+							port->MappingName + " is Missing in a Pipeline Slot.");
+					}
+					else
+					{
+						channels.push_back(nullptr);
+					}
+				}
+				stage->Bindings.emplace_back(port, std::move(channels));
+			}
+
+			Stages.push_back(std::move(stage));
+		}
+
+		SlotWorkflows.push_back(Host);
+		SlotWorkflows.insert(SlotWorkflows.end(), slots.begin(), slots.end());
+
+		for (std::size_t slot_index = 0; slot_index <= slots.size(); ++slot_index)
+		{
+			Frames.push_back(std::make_unique<PipelineFrame>(this, slot_index, stages));
+		}
+	}
+
+	/// 启动流水线
+	std::optional<AbstractExecutor *> FramePipeline::Launch()
+	{
+		if (Stages.empty())
+		{
+			return Host->FinishIteration(true);
+		}
+
+		std::size_t frames_count = Host->Loop ? Frames.size() : 1;
+		Stopping = false;
+		ActiveFramesCount = frames_count;
+		LaunchFrameIndex = NextFrameIndex;
+
+		// 先分配帧序号，再使各帧到达第一个阶段，否则已完成的帧可能抢先取得序号
+		for (std::size_t index = 0; index < frames_count; ++index)
+		{
+			ResetFrame(Frames[index].get(), NextFrameIndex++);
+		}
+		for (std::size_t index = 0; index < frames_count; ++index)
+		{
+			auto* frame = Frames[index].get();
+			if (Arrive(frame, 0))
+			{
+				Dispatch(frame);
+			}
+		}
+		return std::nullopt;
+	}
+
+	/// 将帧重置为从第一个阶段开始
+	void FramePipeline::ResetFrame(PipelineFrame *frame, std::uint64_t frame_index)
+	{
+		frame->FrameIndex = frame_index;
+		frame->StageIndex = 0;
+		frame->NextProcessor = frame->Processors.begin();
+		frame->Skipping = false;
+		frame->EndSuppressed = false;
+	}
+
+	/// 使帧跳过阶段
+	void FramePipeline::SkipFrame(PipelineFrame *frame, AbstractProcessor *target) const
+	{
+		frame->Skipping = true;
+		if (!target)
+		{
+			frame->ResumeStageIndex = Stages.size();
+			return;
+		}
+
+		auto finder = std::find_if(Stages.begin(), Stages.end(), [target](const auto& stage){
+			return stage->Processor == target;
+		});
+		if (finder == Stages.end())
+		{
+			throw std::runtime_error("[FramePipeline::SkipFrame] Jump Target is Not in the Pipeline.");
+		}
+		auto target_index = static_cast<std::size_t>(finder - Stages.begin());
+		if (target_index <= frame->StageIndex)
+		{
+			throw std::runtime_error("[FramePipeline::SkipFrame] Pipeline Can Only Jump Forward.");
+		}
+		// 从跳转目标之后的阶段恢复执行
+		frame->ResumeStageIndex = target_index + 1;
+	}
+
+	/// 获取阶段的执行器
+	AbstractExecutor *FramePipeline::GetStageExecutor(std::size_t stage_index) const
+	{
+		auto* executor = Stages[stage_index]->Executor;
+		if (!executor)
+		{
+			throw std::runtime_error("[FramePipeline::GetStageExecutor] Executor Pointer Reference is Null.");
+		}
+		if (!*executor)
+		{
+			throw std::runtime_error("[FramePipeline::GetStageExecutor] Executor Pointer is Null.");
+		}
+		return *executor;
+	}
+
+	/// 到达阶段
+	bool FramePipeline::Arrive(PipelineFrame *frame, std::size_t stage_index)
+	{
+		auto& stage = *Stages[stage_index];
+		std::unique_lock lock(stage.Mutex);
+		if (stage.NextFrameIndex == frame->FrameIndex)
+		{
+			return true;
+		}
+		stage.ParkedFrames.push_back(frame);
+		return false;
+	}
+
+	/// 调度被放行的帧
+	void FramePipeline::Dispatch(PipelineFrame *frame)
+	{
+		if (frame->Skipping)
+		{
+			// 跳过阶段的帧不执行流处理器，但仍需按顺序通过各阶段
+			auto next_executor = Advance(frame);
+			if (next_executor)
+			{
+				(*next_executor)->Submit(frame);
+			}
+			return;
+		}
+		GetStageExecutor(frame->StageIndex)->Submit(frame);
+	}
+
+	/// 推进帧
+	std::optional<AbstractExecutor *> FramePipeline::Advance(PipelineFrame *frame)
+	{
+		while (true)
+		{
+			auto stage_index = frame->StageIndex;
+			auto& stage = *Stages[stage_index];
+			bool last_stage = stage_index + 1 == Stages.size();
+
+			// 在释放最后一个阶段前触发结束事件，从而保证结束事件按照帧序号依次触发
+			if (last_stage)
+			{
+				if (!frame->EndSuppressed && Host->OnEnd)
+				{
+					Host->OnEnd();
+				}
+				if (!Host->Loop || (Host->LoopStopCondition && Host->LoopStopCondition()))
+				{
+					Stopping = true;
+				}
+			}
+
+			// 释放当前阶段，并放行该阶段的下一帧
+			PipelineFrame* released_frame {nullptr};
+			{
+				std::unique_lock lock(stage.Mutex);
+				++stage.NextFrameIndex;
+				auto finder = std::find_if(stage.ParkedFrames.begin(), stage.ParkedFrames.end(),
+										   [&stage](PipelineFrame* parked){
+					return parked->FrameIndex == stage.NextFrameIndex;
+				});
+				if (finder != stage.ParkedFrames.end())
+				{
+					released_frame = *finder;
+					stage.ParkedFrames.erase(finder);
+				}
+			}
+			if (released_frame)
+			{
+				Dispatch(released_frame);
+			}
+
+			if (!last_stage)
+			{
+				++frame->StageIndex;
+				++frame->NextProcessor;
+				if (frame->Skipping && frame->StageIndex == frame->ResumeStageIndex)
+				{
+					frame->Skipping = false;
+				}
+			}
+			else
+			{
+				if (Stopping)
+				{
+					// 最后一帧离开后，宿主工作流可以被重新提交
+					if (ActiveFramesCount.fetch_sub(1) == 1)
+					{
+						Host->NextProcessor = Host->Processors.begin();
+					}
+					return std::nullopt;
+				}
+				ResetFrame(frame, NextFrameIndex++);
+			}
+
+			if (!Arrive(frame, frame->StageIndex))
+			{
+				return std::nullopt;
+			}
+			if (!frame->Skipping)
+			{
+				return GetStageExecutor(frame->StageIndex);
+			}
+		}
+	}
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "AbstractWorkflow.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Galaxy::Core
+{
+	/// 流处理器接口
+	class AbstractProcessor;
+	/// 抽象执行器类
+	class AbstractExecutor;
+	/// 抽象端口
+	class AbstractPort;
+	/// 抽象通道接口
+	class AbstractChannel;
+	/// 帧流水线
+	class FramePipeline;
+
+	/**
+	 * @brief 流水线帧
+	 * @author Vincent
+	 * @details
+	 *  ~ 每个流水线帧对应一组通道，作为独立的工作流在各阶段的执行器之间传递，从而使多帧可以同时处于不同的阶段。
+	 *  ~ 一帧完成所有阶段后，将以新的帧序号重新从第一个阶段开始。
+	 */
+	class PipelineFrame : public AbstractWorkflow
+	{
+		friend class FramePipeline;
+
+	private:
+		/// 所属的流水线
+		FramePipeline* Pipeline;
+		/// 使用的通道组编号
+		std::size_t SlotIndex;
+		/// 当前的帧序号
+		std::uint64_t FrameIndex {0};
+		/// 当前所处的阶段编号
+		std::size_t StageIndex {0};
+		/// 是否跳过阶段
+		bool Skipping {false};
+		/// 跳过阶段时，恢复执行的阶段编号；等于阶段数量时表示跳过剩余的所有阶段
+		std::size_t ResumeStageIndex {0};
+		/// 是否不触发本帧的结束事件
+		bool EndSuppressed {false};
+
+		/// 执行当前阶段的流处理器
+		std::optional<AbstractExecutor*> IterateExecute() override;
+
+		/// 跳过本帧剩余的阶段
+		std::optional<AbstractExecutor*> Abort() override;
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param pipeline 所属的流水线
+		 * @param slot_index 使用的通道组编号
+		 * @param stages 各阶段的流处理器及其执行器
+		 */
+		PipelineFrame(FramePipeline* pipeline, std::size_t slot_index,
+					  const std::vector<std::tuple<AbstractProcessor*, AbstractExecutor**>>& stages);
+
+		/// 析构函数，流处理器属于宿主工作流，不应由流水线帧终止化
+		~PipelineFrame() override;
+	};
+
+	/**
+	 * @brief 帧流水线
+	 * @author Vincent
+	 * @details
+	 *  ~ 宿主工作流中除初始化处理器以外的每个流处理器为一个阶段；宿主工作流自身和若干同类型的工作流各提供一组通道，
+	 *    通道组的数量即同时处理的帧数上限。
+	 *  ~ 流处理器只存在一份，每个阶段同一时刻只处理一帧，执行前将其端口重新挂载到该帧的通道组上。
+	 *  ~ 每个阶段都带有重排序缓冲：提前到达的帧将被挂起，直至该阶段按照帧序号处理完之前的帧，
+	 *    故各阶段处理帧的顺序与采集顺序相同，最后一个阶段输出的顺序也与采集顺序相同。
+	 *  ~ 开始事件在帧进入第一个阶段时触发，结束事件在帧完成最后一个阶段时触发，两者可能在不同的线程中同时执行。
+	 *  ~ 流处理器请求跳转时，帧将依次通过被跳过的阶段但不执行其流处理器，从而保持各阶段的帧顺序。
+	 */
+	class FramePipeline
+	{
+		friend class PipelineFrame;
+
+	private:
+		/// 流水线阶段
+		struct Stage
+		{
+			/// 流处理器
+			AbstractProcessor* Processor {nullptr};
+			/// 存放执行器指针的指针
+			AbstractExecutor** Executor {nullptr};
+			/// 端口及其在各通道组中对应的通道
+			std::vector<std::pair<AbstractPort*, std::vector<AbstractChannel*>>> Bindings;
+
+			/// 阶段互斥量
+			std::mutex Mutex;
+			/// 该阶段下一个需要处理的帧序号
+			std::uint64_t NextFrameIndex {0};
+			/// 提前到达而被挂起的帧
+			std::vector<PipelineFrame*> ParkedFrames;
+		};
+
+		/// 宿主工作流
+		AbstractWorkflow* Host;
+		/// 阶段列表
+		std::vector<std::unique_ptr<Stage>> Stages;
+		/// 流水线帧列表，下标即通道组编号
+		std::vector<std::unique_ptr<PipelineFrame>> Frames;
+		/// 提供通道组的工作流列表，下标即通道组编号，第0组为宿主工作流
+		std::vector<AbstractWorkflow*> SlotWorkflows;
+
+		/// 下一个需要开始的帧序号
+		std::atomic<std::uint64_t> NextFrameIndex {0};
+		/// 本次启动的第一个帧序号，该帧的开始事件已由初始化处理器触发
+		std::uint64_t LaunchFrameIndex {0};
+		/// 仍在流水线中的帧数
+		std::atomic_size_t ActiveFramesCount {0};
+		/// 是否停止开始新的帧
+		std::atomic_bool Stopping {false};
+
+		/**
+		 * @brief 到达阶段
+		 * @param frame 流水线帧
+		 * @param stage_index 阶段编号
+		 * @retval true 轮到该帧，可以立即处理
+		 * @retval false 该帧已被挂起，将由处理完上一帧的线程调度
+		 */
+		bool Arrive(PipelineFrame* frame, std::size_t stage_index);
+
+		/**
+		 * @brief 调度被放行的帧
+		 * @param frame 流水线帧
+		 * @throw std::runtime_error 当阶段的执行器为空
+		 * @details
+		 *  ~ 跳过剩余阶段的帧将在当前线程中直接通过；否则将被提交到当前阶段的执行器。
+		 */
+		void Dispatch(PipelineFrame* frame);
+
+		/**
+		 * @brief 推进帧
+		 * @param frame 已经处理完当前阶段的帧
+		 * @return 可选，该帧需要前往的执行器；若该帧被挂起或流水线已停止，则返回std::nullopt
+		 * @details
+		 *  ~ 将释放当前阶段并放行下一帧，随后使该帧到达下一个阶段；完成最后一个阶段时，将按照循环设定开始新的帧。
+		 */
+		std::optional<AbstractExecutor*> Advance(PipelineFrame* frame);
+
+		/// 将帧重置为从第一个阶段开始处理指定的帧序号
+		static void ResetFrame(PipelineFrame* frame, std::uint64_t frame_index);
+
+		/**
+		 * @brief 使帧跳过阶段
+		 * @param frame 流水线帧
+		 * @param target 跳转目标，为空时跳过剩余的所有阶段
+		 * @throw std::runtime_error 当跳转目标不在当前阶段之后
+		 */
+		void SkipFrame(PipelineFrame* frame, AbstractProcessor* target) const;
+
+		/**
+		 * @brief 获取阶段的执行器
+		 * @param stage_index 阶段编号
+		 * @throw std::runtime_error 当阶段的执行器为空
+		 * @return 执行器指针
+		 */
+		AbstractExecutor* GetStageExecutor(std::size_t stage_index) const;
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param host 宿主工作流，其端口须已挂载
+		 * @param slots 提供其余通道组的工作流，须与宿主工作流类型相同
+		 * @throw std::runtime_error 当通道组工作流的类型与宿主不同，或缺少必要的通道
+		 */
+		FramePipeline(AbstractWorkflow* host, const std::vector<AbstractWorkflow*>& slots);
+
+		FramePipeline(const FramePipeline&) = delete;
+		FramePipeline& operator=(const FramePipeline&) = delete;
+
+		/**
+		 * @brief 启动流水线
+		 * @return 可选，宿主工作流需要前往的执行器；帧均已开始时返回std::nullopt
+		 * @details
+		 *  ~ 开启循环时将同时开始与通道组数量相同的帧，否则只开始一帧。
+		 */
+		std::optional<AbstractExecutor*> Launch();
+
+		/**
+		 * @brief 获取流水线深度
+		 * @return 通道组的数量，即同时处理的帧数上限
+		 */
+		[[nodiscard]] std::size_t GetDepth() const
+		{
+			return Frames.size();
+		}
+	};
+}
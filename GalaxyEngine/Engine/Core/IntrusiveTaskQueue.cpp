@@ -0,0 +1,195 @@
+#include "IntrusiveTaskQueue.hpp"
+#include "Tools/WorkflowAccess.hpp"
+
+#include <thread>
+
+namespace Galaxy::Core
+{
+	//==============================
+	// 任务链部分
+	//==============================
+
+	/// 追加工作流到链尾
+	void TaskChain::Append(AbstractWorkflow *workflow)
+	{
+		auto* link = Tools::WorkflowAccess::GetTaskLink(workflow);
+		link->Previous = Last;
+		link->Next.store(nullptr, std::memory_order_relaxed);
+		if (Last)
+		{
+			Last->Next.store(link, std::memory_order_relaxed);
+		}
+		else
+		{
+			First = link;
+		}
+		Last = link;
+		++Count;
+	}
+
+	//==============================
+	// 侵入式任务队列部分
+	//==============================
+
+	/// 构造函数
+	IntrusiveTaskQueue::IntrusiveTaskQueue() : Head(&Stub), Tail(&Stub)
+	{}
+
+	/// 将节点链放入队列
+	void IntrusiveTaskQueue::PushChain(TaskLink *first, TaskLink *last)
+	{
+		last->Next.store(nullptr, std::memory_order_relaxed);
+		auto* previous = Head.exchange(last, std::memory_order_acq_rel);
+		// 在此之前消费者无法越过previous，故出队可能暂时失败
+		previous->Next.store(first, std::memory_order_release);
+	}
+
+	/// 入队
+	void IntrusiveTaskQueue::Push(AbstractWorkflow *workflow)
+	{
+		auto* link = Tools::WorkflowAccess::GetTaskLink(workflow);
+		Length.fetch_add(1, std::memory_order_release);
+		PushChain(link, link);
+	}
+
+	/// 批量入队
+	void IntrusiveTaskQueue::Push(const TaskChain &chain)
+	{
+		if (chain.Empty()) return;
+
+		Length.fetch_add(chain.Count, std::memory_order_release);
+		PushChain(chain.First, chain.Last);
+	}
+
+	/// 在持有消费权时出队
+	bool IntrusiveTaskQueue::PopExclusively(AbstractWorkflow *&workflow)
+	{
+		auto* tail = Tail;
+		auto* next = tail->Next.load(std::memory_order_acquire);
+
+		// 跳过哨兵节点
+		if (tail == &Stub)
+		{
+			if (!next) return false;
+			Tail = next;
+			tail = next;
+			next = next->Next.load(std::memory_order_acquire);
+		}
+
+		if (next)
+		{
+			Tail = next;
+			workflow = tail->Owner;
+			return true;
+		}
+
+		// tail为最后一个节点，若生产者正在入队，则稍后重试
+		if (tail != Head.load(std::memory_order_acquire)) return false;
+
+		// 重新放入哨兵节点，使tail拥有后继从而可以被取出
+		PushChain(&Stub, &Stub);
+		next = tail->Next.load(std::memory_order_acquire);
+		if (next)
+		{
+			Tail = next;
+			workflow = tail->Owner;
+			return true;
+		}
+		return false;
+	}
+
+	/// 尝试出队
+	bool IntrusiveTaskQueue::TryPop(AbstractWorkflow *&workflow, bool wait_for_consumer)
+	{
+		if (Empty()) return false;
+
+		while (ConsumerFlag.test_and_set(std::memory_order_acquire))
+		{
+			if (!wait_for_consumer) return false;
+			std::this_thread::yield();
+		}
+
+		bool popped = PopExclusively(workflow);
+		if (popped)
+		{
+			Length.fetch_sub(1, std::memory_order_release);
+		}
+
+		ConsumerFlag.clear(std::memory_order_release);
+		return popped;
+	}
+
+	//==============================
+	// 侵入式任务列表部分
+	//==============================
+
+	/// 从尾部放入
+	void IntrusiveTaskList::PushBack(AbstractWorkflow *workflow)
+	{
+		auto* link = Tools::WorkflowAccess::GetTaskLink(workflow);
+		link->Previous = Last;
+		link->Next.store(nullptr, std::memory_order_relaxed);
+		if (Last)
+		{
+			Last->Next.store(link, std::memory_order_relaxed);
+		}
+		else
+		{
+			First = link;
+		}
+		Last = link;
+	}
+
+	/// 将整条任务链从尾部放入
+	void IntrusiveTaskList::PushBack(const TaskChain &chain)
+	{
+		if (chain.Empty()) return;
+
+		chain.First->Previous = Last;
+		if (Last)
+		{
+			Last->Next.store(chain.First, std::memory_order_relaxed);
+		}
+		else
+		{
+			First = chain.First;
+		}
+		Last = chain.Last;
+	}
+
+	/// 从头部取出
+	AbstractWorkflow *IntrusiveTaskList::PopFront()
+	{
+		if (!First) return nullptr;
+
+		auto* link = First;
+		First = link->Next.load(std::memory_order_relaxed);
+		if (First)
+		{
+			First->Previous = nullptr;
+		}
+		else
+		{
+			Last = nullptr;
+		}
+		return link->Owner;
+	}
+
+	/// 从尾部取出
+	AbstractWorkflow *IntrusiveTaskList::PopBack()
+	{
+		if (!Last) return nullptr;
+
+		auto* link = Last;
+		Last = link->Previous;
+		if (Last)
+		{
+			Last->Next.store(nullptr, std::memory_order_relaxed);
+		}
+		else
+		{
+			First = nullptr;
+		}
+		return link->Owner;
+	}
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace Galaxy::Core
+{
+	/// 抽象工作流类
+	class AbstractWorkflow;
+
+	/**
+	 * @brief 任务链接节点
+	 * @author Vincent
+	 * @details
+	 *  ~ 该节点内嵌在工作流中，工作流入队时不需要分配内存。
+	 *  ~ 同一时刻一个工作流只会位于一个执行器的一个队列中，故一个节点即可满足所有队列的需要。
+	 */
+	struct TaskLink
+	{
+		/// 后继节点
+		std::atomic<TaskLink*> Next {nullptr};
+		/// 前驱节点，仅由侵入式任务列表使用
+		TaskLink* Previous {nullptr};
+		/// 所属工作流
+		AbstractWorkflow* Owner {nullptr};
+		/// 到期时间，由计时执行器在提交时写入，工作线程取出后据此将工作流停放在时间轮中
+		std::chrono::steady_clock::time_point DueTime {};
+	};
+
+	/**
+	 * @brief 任务链
+	 * @author Vincent
+	 * @details
+	 *  ~ 用于在本地将多个工作流按顺序串联起来，随后一次性放入侵入式任务队列或任务列表。
+	 */
+	class TaskChain
+	{
+		friend class IntrusiveTaskQueue;
+		friend class IntrusiveTaskList;
+	private:
+		/// 头部节点
+		TaskLink* First {nullptr};
+		/// 尾部节点
+		TaskLink* Last {nullptr};
+		/// 节点数量
+		std::size_t Count {0};
+
+	public:
+		/// 追加工作流到链尾
+		void Append(AbstractWorkflow* workflow);
+
+		/// 查询任务链是否为空
+		[[nodiscard]] bool Empty() const
+		{
+			return Count == 0;
+		}
+
+		/// 获取任务链中的工作流数量
+		[[nodiscard]] std::size_t Size() const
+		{
+			return Count;
+		}
+	};
+
+	/**
+	 * @brief 侵入式任务队列
+	 * @author Vincent
+	 * @details
+	 *  ~ 多生产者单消费者的无锁队列，链接节点内嵌在工作流中，入队和出队均不分配内存。
+	 *  ~ 入队只需要一次原子交换；多个线程同时出队时，只有取得消费权的线程可以出队，其余线程将立即返回失败。
+	 *  ~ 生产者完成原子交换但尚未链接前驱时，出队可能暂时失败，此时队列长度不为0，调用者稍后重试即可。
+	 */
+	class IntrusiveTaskQueue
+	{
+	private:
+		/// 生产者端，指向最后入队的节点
+		alignas(64) std::atomic<TaskLink*> Head;
+		/// 消费者端，指向下一个出队的节点
+		alignas(64) TaskLink* Tail;
+		/// 哨兵节点
+		TaskLink Stub;
+		/// 消费权旗标
+		std::atomic_flag ConsumerFlag = ATOMIC_FLAG_INIT;
+		/// 队列长度
+		std::atomic_size_t Length {0};
+
+		/// 将已经互相链接的节点链放入队列
+		void PushChain(TaskLink* first, TaskLink* last);
+
+		/// 在持有消费权时出队
+		bool PopExclusively(AbstractWorkflow*& workflow);
+
+	public:
+		/// 构造函数
+		IntrusiveTaskQueue();
+
+		IntrusiveTaskQueue(const IntrusiveTaskQueue&) = delete;
+		IntrusiveTaskQueue& operator=(const IntrusiveTaskQueue&) = delete;
+
+		/**
+		 * @brief 入队
+		 * @param workflow 工作流指针
+		 */
+		void Push(AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 批量入队
+		 * @param chain 任务链，入队后不应再使用
+		 * @details
+		 *  ~ 整条任务链只需要一次原子交换，且保持链中的顺序。
+		 */
+		void Push(const TaskChain& chain);
+
+		/**
+		 * @brief 尝试出队
+		 * @param workflow 用于存放出队的工作流
+		 * @param wait_for_consumer 其他线程正在出队时是否等待其完成
+		 * @retval true 成功出队
+		 * @retval false 队列为空、生产者尚未完成链接或其他线程正在出队
+		 */
+		bool TryPop(AbstractWorkflow*& workflow, bool wait_for_consumer = false);
+
+		/**
+		 * @brief 查询队列是否为空
+		 * @retval true 队列为空
+		 * @retval false 队列非空
+		 */
+		[[nodiscard]] bool Empty() const
+		{
+			return Length.load(std::memory_order_acquire) == 0;
+		}
+
+		/**
+		 * @brief 获取队列长度
+		 * @return 队列中的工作流数量
+		 */
+		[[nodiscard]] std::size_t Size() const
+		{
+			return Length.load(std::memory_order_acquire);
+		}
+	};
+
+	/**
+	 * @brief 侵入式任务列表
+	 * @author Vincent
+	 * @details
+	 *  ~ 双端链表，链接节点内嵌在工作流中，不分配内存。
+	 *  ~ 该列表不是线程安全的，应当在互斥量的保护下使用。
+	 */
+	class IntrusiveTaskList
+	{
+	private:
+		/// 头部节点
+		TaskLink* First {nullptr};
+		/// 尾部节点
+		TaskLink* Last {nullptr};
+
+	public:
+		/// 从尾部放入
+		void PushBack(AbstractWorkflow* workflow);
+		/// 将整条任务链从尾部放入，任务链放入后不应再使用
+		void PushBack(const TaskChain& chain);
+		/// 从头部取出，列表为空时返回空指针
+		AbstractWorkflow* PopFront();
+		/// 从尾部取出，列表为空时返回空指针
+		AbstractWorkflow* PopBack();
+
+		/// 查询列表是否为空
+		[[nodiscard]] bool Empty() const
+		{
+			return First == nullptr;
+		}
+	};
+}
@@ -14,4 +14,10 @@ namespace Galaxy::Core::Tools
 	{
 		return port->MappingName;
 	}
+
+	/// 获取挂载的通道
+	AbstractChannel *PortAccess::GetChannel(AbstractPort *port)
+	{
+		return port->MountedChannel;
+	}
 }
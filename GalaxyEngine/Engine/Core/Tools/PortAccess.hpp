@@ -22,6 +22,8 @@ namespace Galaxy::Core
 			static void AttachToChannel(AbstractPort* port, AbstractChannel* channel);
 			/// 获取名称
 			static auto GetName(AbstractPort* port) -> const std::string&;
+			/// 获取挂载的通道
+			static AbstractChannel* GetChannel(AbstractPort* port);
 		};
 	}
 }
\ No newline at end of file
@@ -52,4 +52,32 @@ namespace Galaxy::Core::Tools
 		processor->StopWorkflowFlag = false;
 		processor->PauseWorkflowFlag = false;
 	}
-}
\ No newline at end of file
+
+	/// 取出跳转请求
+	auto ProcessorAccess::TakeJumpRequest(AbstractProcessor *processor) -> std::optional<AbstractProcessor *>
+	{
+		if (!processor->JumpRequested)
+		{
+			return std::nullopt;
+		}
+		processor->JumpRequested = false;
+		return processor->JumpTarget;
+	}
+
+	/// 取出挂起请求
+	auto ProcessorAccess::TakeSuspendRequest(AbstractProcessor *processor) -> std::optional<bool>
+	{
+		if (!processor->SuspendRequested)
+		{
+			return std::nullopt;
+		}
+		processor->SuspendRequested = false;
+		return processor->RepeatRequested;
+	}
+
+	/// 重置恢复点
+	void ProcessorAccess::ResetResumePoint(AbstractProcessor *processor)
+	{
+		processor->ResumePoint = 0;
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <optional>
 #include <tbb/tbb.h>
 
 namespace Galaxy::Core
@@ -37,6 +38,13 @@ namespace Galaxy::Core
 			static bool IsStopFlagOn(AbstractProcessor* processor);
 			//// 重设所有的旗标，当旗标起效后该方法将被调用
 			static void ResetFlags(AbstractProcessor* processor);
+
+			/// 取出跳转请求，若存在则返回跳转目标，目标为空表示跳转至末尾
+			static auto TakeJumpRequest(AbstractProcessor* processor) -> std::optional<AbstractProcessor*>;
+			/// 取出挂起请求，若存在则返回汇合后是否需要重新执行该流处理器
+			static auto TakeSuspendRequest(AbstractProcessor* processor) -> std::optional<bool>;
+			/// 重置恢复点，使下一次执行从头开始
+			static void ResetResumePoint(AbstractProcessor* processor);
 		};
 	}
 }
\ No newline at end of file
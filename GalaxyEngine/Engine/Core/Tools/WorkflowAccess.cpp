@@ -4,6 +4,8 @@
 #include "../AbstractWorkflow.hpp"
 #include "../AbstractChannel.hpp"
 
+#include <stdexcept>
+
 namespace Galaxy::Core::Tools
 {
 	/// 注册流处理器
@@ -16,7 +18,7 @@ namespace Galaxy::Core::Tools
 	/// 注册通道
 	void WorkflowAccess::RegisterChannel(AbstractWorkflow *workflow, AbstractChannel *channel, const std::string& name)
 	{
-		workflow->Channels.emplace(name, channel);
+		workflow->Channels.emplace(ChannelNameTable::Intern(name), channel);
 	}
 
 	/// 迭代执行
@@ -34,12 +36,20 @@ namespace Galaxy::Core::Tools
 	/// 获取通道
 	AbstractChannel *WorkflowAccess::GetChannel(AbstractWorkflow *workflow, const std::string& name)
 	{
-		auto finder = workflow->Channels.find(name);
-		if (finder != workflow->Channels.end())
+		// 只查找而不登记名称，以免查询不存在的通道时扩充名称表
+		auto id = ChannelNameTable::Find(name);
+		auto* channel = id ? workflow->FindChannel(*id) : nullptr;
+		if (!channel)
 		{
-			return finder->second;
+			throw std::runtime_error("[WorkflowAccess::GetChannel] A Channel Named " + name + " is Missing.");
 		}
-		return nullptr;
+		return channel;
+	}
+
+	/// 获取通道
+	AbstractChannel *WorkflowAccess::GetChannel(AbstractWorkflow *workflow, ChannelID id)
+	{
+		return workflow->FindChannel(id);
 	}
 
 	/// 注册通道
@@ -48,7 +58,7 @@ namespace Galaxy::Core::Tools
 	{
 		for (const auto& name : names)
 		{
-			workflow->Channels.emplace(name, channel);
+			workflow->Channels.emplace(ChannelNameTable::Intern(name), channel);
 		}
 	}
 
@@ -65,4 +75,73 @@ namespace Galaxy::Core::Tools
 		}
 		return nullptr;
 	}
-}
\ No newline at end of file
+
+	/// 获取下一个将要执行的流处理器
+	AbstractProcessor* WorkflowAccess::GetNextProcessor(AbstractWorkflow *workflow)
+	{
+		if (workflow->NextProcessor != workflow->Processors.end())
+		{
+			return std::get<0>(*(workflow->NextProcessor));
+		}
+		return nullptr;
+	}
+
+	/// 设置需要等待的汇合次数
+	void WorkflowAccess::PrepareJoin(AbstractWorkflow *workflow, std::size_t count)
+	{
+		// 额外的一次汇合由挂起的工作流自身在迭代执行结束时完成
+		workflow->PendingJoinsCount.store(count + 1, std::memory_order_release);
+	}
+
+	/// 查询是否允许挂起
+	bool WorkflowAccess::IsSuspendable(AbstractWorkflow *workflow)
+	{
+		return !workflow->UseDependencyGraph && workflow->PipelineSlots.empty();
+	}
+
+	/// 汇合
+	auto WorkflowAccess::Join(AbstractWorkflow *workflow) -> std::optional<AbstractExecutor *>
+	{
+		if (!workflow->ArriveAtJoin())
+		{
+			return std::nullopt;
+		}
+		return workflow->ContinueIteration(false, false);
+	}
+
+	/// 获取等待区使用的原子状态字
+	auto WorkflowAccess::GetWaitingStateWord(AbstractWorkflow *workflow) -> std::atomic<std::uint64_t> &
+	{
+		return workflow->WaitingStateWord;
+	}
+
+	/// 放弃本次迭代
+	auto WorkflowAccess::Abort(AbstractWorkflow *workflow) -> std::optional<AbstractExecutor *>
+	{
+		return workflow->Abort();
+	}
+
+	/// 标记为已被取代
+	void WorkflowAccess::MarkSuperseded(AbstractWorkflow *workflow)
+	{
+		workflow->Superseded = true;
+	}
+
+	/// 清除被取代标记
+	bool WorkflowAccess::ResetSuperseded(AbstractWorkflow *workflow)
+	{
+		return workflow->Superseded.exchange(false);
+	}
+
+	/// 获取任务链接节点
+	TaskLink *WorkflowAccess::GetTaskLink(AbstractWorkflow *workflow)
+	{
+		return &workflow->QueueLink;
+	}
+
+	/// 查询是否允许被合并策略取代
+	bool WorkflowAccess::IsCoalescable(AbstractWorkflow *workflow)
+	{
+		return workflow->Coalescable;
+	}
+}
@@ -3,6 +3,10 @@
 #include <string>
 #include <initializer_list>
 #include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include "../ChannelNameTable.hpp"
 
 namespace Galaxy::Core
 {
@@ -10,6 +14,7 @@ namespace Galaxy::Core
 	class AbstractProcessor;
 	class AbstractExecutor;
 	class AbstractChannel;
+	struct TaskLink;
 
 	namespace Tools
 	{
@@ -36,11 +41,36 @@ namespace Galaxy::Core
 			/// 初始化
 			static void Initialize(AbstractWorkflow* workflow);
 
-			/// 获取通道
+			/// 获取通道，将查询名称表，不应在执行期间调用；工作流中没有该名称的通道时抛出异常
 			static AbstractChannel* GetChannel(AbstractWorkflow* workflow, const std::string& name);
+			/// 获取通道
+			static AbstractChannel* GetChannel(AbstractWorkflow* workflow, ChannelID id);
 
 			/// 获取当前的执行器
 			static AbstractExecutor* GetCurrentExecutor(AbstractWorkflow* workflow);
+			/// 获取下一个将要执行的流处理器
+			static AbstractProcessor* GetNextProcessor(AbstractWorkflow* workflow);
+
+			/// 设置需要等待的汇合次数
+			static void PrepareJoin(AbstractWorkflow* workflow, std::size_t count);
+			/// 查询是否允许挂起，依赖图模式和流水线模式下不允许
+			static bool IsSuspendable(AbstractWorkflow* workflow);
+			/// 汇合，若为最后一个汇合者，则继续本次迭代并返回需要前往的执行器
+			static auto Join(AbstractWorkflow* workflow) -> std::optional<AbstractExecutor*>;
+
+			/// 获取等待区使用的原子状态字
+			static auto GetWaitingStateWord(AbstractWorkflow* workflow) -> std::atomic<std::uint64_t>&;
+
+			/// 放弃本次迭代
+			static auto Abort(AbstractWorkflow* workflow) -> std::optional<AbstractExecutor*>;
+			/// 标记为已被取代
+			static void MarkSuperseded(AbstractWorkflow* workflow);
+			/// 清除被取代标记，并返回清除前是否已被取代
+			static bool ResetSuperseded(AbstractWorkflow* workflow);
+			/// 获取任务链接节点
+			static TaskLink* GetTaskLink(AbstractWorkflow* workflow);
+			/// 查询是否允许被合并策略取代
+			static bool IsCoalescable(AbstractWorkflow* workflow);
 		};
 	}
 
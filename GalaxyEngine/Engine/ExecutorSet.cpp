@@ -0,0 +1,130 @@
+#include "ExecutorSet.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Galaxy
+{
+	/// 构造函数
+	ExecutorSet::ExecutorSet(const CPUTopology &topology, std::size_t minimum_big_cores)
+	{
+		std::vector<unsigned int> big_processors;
+		std::vector<std::vector<unsigned int>> little_clusters;
+		for (const auto& cluster : topology.Clusters)
+		{
+			if (cluster.Fast)
+			{
+				big_processors.insert(big_processors.end(), cluster.Processors.begin(), cluster.Processors.end());
+			}
+			else
+			{
+				little_clusters.push_back(cluster.Processors);
+			}
+		}
+
+		// 快速处理器不足时，从最大的簇中划出编号最大的处理器
+		while (big_processors.size() < minimum_big_cores)
+		{
+			auto largest = std::max_element(little_clusters.begin(), little_clusters.end(),
+			                                [](const auto& left, const auto& right){
+				return left.size() < right.size();
+			});
+			if (largest == little_clusters.end() || largest->size() <= 1) break;
+
+			auto highest = std::max_element(largest->begin(), largest->end());
+			big_processors.push_back(*highest);
+			largest->erase(highest);
+		}
+
+		for (auto processor : big_processors)
+		{
+			auto executor = std::make_unique<SerialExecutor>();
+			executor->SetCPUAffinity({processor});
+			BigCores.push_back(executor.get());
+			OwnedExecutors.push_back(std::move(executor));
+		}
+		// 处理器仍然不足时，补充不绑定CPU的串行执行器
+		while (BigCores.size() < minimum_big_cores)
+		{
+			auto executor = std::make_unique<SerialExecutor>();
+			BigCores.push_back(executor.get());
+			OwnedExecutors.push_back(std::move(executor));
+		}
+
+		for (const auto& processors : little_clusters)
+		{
+			if (processors.empty()) continue;
+
+			auto executor = std::make_unique<ParallelExecutor>();
+			executor->SetCPUAffinity(processors);
+			LittleClusters.push_back(executor.get());
+			OwnedExecutors.push_back(std::move(executor));
+		}
+		// 没有剩余的簇时，使用所有在线的处理器构建一个并行执行器
+		if (LittleClusters.empty())
+		{
+			auto executor = std::make_unique<ParallelExecutor>();
+			executor->SetCPUAffinity(topology.GetOnlineProcessors());
+			LittleClusters.push_back(executor.get());
+			OwnedExecutors.push_back(std::move(executor));
+		}
+
+		for (std::size_t index = 0; index < BigCores.size(); ++index)
+		{
+			NamedExecutors.emplace("Big" + std::to_string(index), BigCores[index]);
+		}
+		for (std::size_t index = 0; index < LittleClusters.size(); ++index)
+		{
+			NamedExecutors.emplace("Little" + std::to_string(index), LittleClusters[index]);
+		}
+	}
+
+	/// 获取执行器
+	Core::AbstractExecutor *ExecutorSet::Get(const std::string &name) const
+	{
+		auto finder = NamedExecutors.find(name);
+		if (finder == NamedExecutors.end())
+		{
+			throw std::runtime_error("[ExecutorSet::Get] Executor Named " + name + " is Missing.");
+		}
+		return finder->second;
+	}
+
+	/// 获取所有执行器
+	std::vector<Core::AbstractExecutor *> ExecutorSet::GetAll() const
+	{
+		std::vector<Core::AbstractExecutor*> executors;
+		for (const auto& executor : OwnedExecutors)
+		{
+			executors.push_back(executor.get());
+		}
+		return executors;
+	}
+
+	/// 启动所有执行器
+	void ExecutorSet::StartAll()
+	{
+		for (const auto& executor : OwnedExecutors)
+		{
+			executor->Start();
+		}
+	}
+
+	/// 停止所有执行器
+	void ExecutorSet::StopAll()
+	{
+		for (const auto& executor : OwnedExecutors)
+		{
+			executor->Stop();
+		}
+	}
+
+	/// 阻塞调用线程
+	void ExecutorSet::JoinAll()
+	{
+		for (const auto& executor : OwnedExecutors)
+		{
+			executor->Join();
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CPUTopology.hpp"
+#include "Executors/SerialExecutor.hpp"
+#include "Executors/ParallelExecutor.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Galaxy
+{
+	/**
+	 * @brief 执行器集合
+	 * @author Vincent
+	 * @details
+	 *  ~ 根据处理器拓扑构建并持有一组具名执行器。
+	 *  ~ 每个快速处理器对应一个串行执行器，依次命名为"Big0"、"Big1"等；
+	 *    其余每个簇对应一个并行执行器，按照性能由高到低依次命名为"Little0"、"Little1"等。
+	 *  ~ 若快速处理器的数量少于要求，则从最大的簇中划出编号最大的处理器作为快速处理器，但每个簇至少保留一个处理器；
+	 *    处理器仍然不足时，将补充不绑定CPU的串行执行器。
+	 */
+	class ExecutorSet
+	{
+	private:
+		/// 持有的执行器
+		std::vector<std::unique_ptr<Core::AbstractExecutor>> OwnedExecutors;
+		/// 名称映射表
+		std::unordered_map<std::string, Core::AbstractExecutor*> NamedExecutors;
+
+	public:
+		/// 大核串行执行器列表，下标与名称中的编号相同
+		std::vector<SerialExecutor*> BigCores;
+		/// 小核簇并行执行器列表，下标与名称中的编号相同
+		std::vector<ParallelExecutor*> LittleClusters;
+
+		/**
+		 * @brief 构造函数
+		 * @param topology 处理器拓扑
+		 * @param minimum_big_cores 至少需要的大核串行执行器数量
+		 */
+		explicit ExecutorSet(const CPUTopology& topology, std::size_t minimum_big_cores = 0);
+
+		/**
+		 * @brief 获取执行器
+		 * @param name 执行器名称
+		 * @throw std::runtime_error 当不存在该名称的执行器
+		 * @return 执行器指针
+		 */
+		[[nodiscard]] Core::AbstractExecutor* Get(const std::string& name) const;
+
+		/**
+		 * @brief 获取所有执行器
+		 * @return 执行器指针列表
+		 */
+		[[nodiscard]] std::vector<Core::AbstractExecutor*> GetAll() const;
+
+		/// 启动所有执行器
+		void StartAll();
+		/// 停止所有执行器
+		void StopAll();
+		/// 阻塞调用线程，直至所有执行器结束
+		void JoinAll();
+	};
+}
@@ -0,0 +1,109 @@
+#include "DeadlineExecutor.hpp"
+#include "GalaxyEngine/Engine/Core/AbstractWorkflow.hpp"
+
+#include <algorithm>
+
+namespace Galaxy
+{
+	/// 判断排队项是否更紧急
+	bool DeadlineExecutor::IsMoreUrgent(const TaskEntry &left, const TaskEntry &right)
+	{
+		if (left.Priority != right.Priority)
+		{
+			return left.Priority > right.Priority;
+		}
+		if (left.Deadline.has_value() != right.Deadline.has_value())
+		{
+			return left.Deadline.has_value();
+		}
+		if (left.Deadline && *left.Deadline != *right.Deadline)
+		{
+			return *left.Deadline < *right.Deadline;
+		}
+		return left.Sequence < right.Sequence;
+	}
+
+	/// 默认构造函数
+	DeadlineExecutor::DeadlineExecutor() : AbstractExecutor()
+	{
+		SetMaxInlineHops(0);
+	}
+
+	/// 设置CPU亲和性的构造函数
+	DeadlineExecutor::DeadlineExecutor(std::initializer_list<unsigned int> cpus) : AbstractExecutor(cpus)
+	{
+		SetMaxInlineHops(0);
+	}
+
+	/// 批量提交工作流
+	void DeadlineExecutor::SubmitBatch(const std::vector<Core::AbstractWorkflow *> &workflows)
+	{
+		SubmitBatchToTasks(workflows);
+	}
+
+	/// 将任务队列中的工作流移入就绪堆
+	void DeadlineExecutor::CollectSubmittedTasks()
+	{
+		Core::AbstractWorkflow* workflow {nullptr};
+		while (Tasks.TryPop(workflow, true))
+		{
+			ReadyTasks.push_back({workflow->Deadline, workflow->Priority, NextSequence++, workflow});
+			std::push_heap(ReadyTasks.begin(), ReadyTasks.end(), IsLessUrgent);
+		}
+	}
+
+	/// 查询任务队列是否为空
+	bool DeadlineExecutor::IsEmpty() const
+	{
+		std::unique_lock lock(QueueMutex);
+		return ReadyTasks.empty() && Tasks.Empty();
+	}
+
+	/// 更新事件
+	void DeadlineExecutor::OnUpdateWorkingThread()
+	{
+		std::optional<TaskEntry> entry;
+		{
+			std::unique_lock lock(QueueMutex);
+			CollectSubmittedTasks();
+			if (!ReadyTasks.empty())
+			{
+				std::pop_heap(ReadyTasks.begin(), ReadyTasks.end(), IsLessUrgent);
+				entry = ReadyTasks.back();
+				ReadyTasks.pop_back();
+			}
+		}
+
+		if (!entry)
+		{
+			// 为空，则按照空闲策略等待
+			Idle(IdleRounds);
+			return;
+		}
+		IdleRounds = 0;
+
+		if (entry->Deadline && std::chrono::steady_clock::now() > *entry->Deadline)
+		{
+			MissedDeadlinesCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		if (ClaimTask(entry->Workflow))
+		{
+			AbstractExecutor::InvokeWorkflow(entry->Workflow);
+		}
+	}
+
+	/// 取出最不紧急的任务
+	bool DeadlineExecutor::TakeOldestTask(Core::AbstractWorkflow *&workflow)
+	{
+		std::unique_lock lock(QueueMutex);
+		CollectSubmittedTasks();
+		if (ReadyTasks.empty()) return false;
+
+		auto least_urgent = std::max_element(ReadyTasks.begin(), ReadyTasks.end(), IsMoreUrgent);
+		workflow = least_urgent->Workflow;
+		ReadyTasks.erase(least_urgent);
+		std::make_heap(ReadyTasks.begin(), ReadyTasks.end(), IsLessUrgent);
+		return true;
+	}
+}
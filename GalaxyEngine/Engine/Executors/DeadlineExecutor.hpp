@@ -0,0 +1,124 @@
+#pragma once
+
+#include "GalaxyEngine/Engine/Core/AbstractExecutor.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <optional>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Galaxy
+{
+	/**
+	 * @brief 截止期限执行器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该执行器将串行地执行工作流，但不按照提交顺序，而是每次选出最紧急的工作流执行。
+	 *  ~ 优先级高的工作流总是先于优先级低的工作流；同一优先级中，截止期限早的先执行，
+	 *    没有截止期限的排在有截止期限的之后；其余情况按照提交顺序执行。
+	 *  ~ 提交的工作流先放入侵入式任务队列，提交不加锁也不分配内存；工作线程每次选取前将其移入就绪堆，
+	 *    工作流的优先级和截止期限在此时读取，此后的修改不会影响其位置。
+	 *  ~ 就绪堆的存储在出堆后保留，容量达到排队的峰值后不再分配内存。
+	 *  ~ 为使紧急的工作流能在流处理器之间插队，该执行器默认不连续直接执行同一工作流。
+	 */
+	class DeadlineExecutor : public Core::AbstractExecutor
+	{
+	private:
+		/// 排队项
+		struct TaskEntry
+		{
+			/// 提交时的截止期限
+			std::optional<std::chrono::steady_clock::time_point> Deadline;
+			/// 提交时的优先级
+			int Priority;
+			/// 提交序号，用于保持同等紧急程度的工作流的提交顺序
+			std::uint64_t Sequence;
+			/// 工作流指针
+			Core::AbstractWorkflow* Workflow;
+		};
+
+		/**
+		 * @brief 判断排队项是否更紧急
+		 * @param left 左侧排队项
+		 * @param right 右侧排队项
+		 * @retval true 左侧排队项应当先被执行
+		 * @retval false 右侧排队项应当先被执行
+		 */
+		static bool IsMoreUrgent(const TaskEntry& left, const TaskEntry& right);
+
+		/**
+		 * @brief 判断排队项是否更不紧急
+		 * @details
+		 *  ~ 作为堆比较器使用，使堆顶为最紧急的排队项。
+		 */
+		static bool IsLessUrgent(const TaskEntry& left, const TaskEntry& right)
+		{
+			return IsMoreUrgent(right, left);
+		}
+
+		/// 就绪堆互斥量
+		mutable std::mutex QueueMutex;
+		/// 就绪任务堆，堆顶为最紧急的任务
+		std::vector<TaskEntry> ReadyTasks;
+		/// 下一个提交序号
+		std::uint64_t NextSequence {0};
+
+		/**
+		 * @brief 将任务队列中的工作流移入就绪堆
+		 * @details
+		 *  ~ 调用者须持有就绪堆互斥量，任务队列的出队顺序即提交顺序。
+		 */
+		void CollectSubmittedTasks();
+
+		/// 出队时已经超过截止期限的次数
+		std::atomic<std::uint64_t> MissedDeadlinesCount {0};
+
+		/// 工作线程连续空闲的次数
+		unsigned int IdleRounds {0};
+
+	public:
+		/// 默认构造函数
+		DeadlineExecutor();
+
+		/**
+		 * @brief 设置CPU亲和性的构造函数
+		 * @param cpus 处理器编号列表
+		 */
+		DeadlineExecutor(std::initializer_list<unsigned int> cpus);
+
+		/**
+		 * @brief 批量提交工作流
+		 * @param workflows 将要被执行的工作流列表
+		 * @throw std::runtime_error 当列表中存在空指针
+		 * @details
+		 *  ~ 整批工作流串联后一次性放入任务队列。
+		 */
+		void SubmitBatch(const std::vector<Core::AbstractWorkflow*>& workflows) override;
+
+		/**
+		 * @brief 查询任务队列是否为空
+		 * @retval true 当任务队列为空
+		 * @retval false 当任务队列非空
+		 */
+		[[nodiscard]] bool IsEmpty() const override;
+
+		/**
+		 * @brief 获取错过截止期限的次数
+		 * @return 工作流出队时已经超过其截止期限的次数，每个流处理器出队一次
+		 */
+		[[nodiscard]] std::uint64_t GetMissedDeadlinesCount() const
+		{
+			return MissedDeadlinesCount.load(std::memory_order_relaxed);
+		}
+
+	protected:
+		/// 更新事件，将取出最紧急的工作流并执行
+		void OnUpdateWorkingThread() override;
+
+		/// 取出最不紧急的任务，队列已满需要放弃任务时将放弃最不紧急的任务
+		bool TakeOldestTask(Core::AbstractWorkflow*& workflow) override;
+	};
+}
@@ -1,51 +1,392 @@
 #include "ParallelExecutor.hpp"
 
-#include <tbb/tbb.h>
-
+#include <stdexcept>
 #include <utility>
+#include <future>
+#include <algorithm>
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
 
 namespace Galaxy
 {
+	/// 当前线程所属的并行执行器
+	thread_local const ParallelExecutor* CurrentWorkerOwner {nullptr};
+	/// 当前线程在所属并行执行器中的工作者编号
+	thread_local std::size_t CurrentWorkerIndex {0};
+	/// 当前线程所在任务区所属的并行执行器
+	thread_local const ParallelExecutor* CurrentArenaOwner {nullptr};
+	/// 当前线程进入任务区之前的CPU亲和性
+	thread_local cpu_set_t PreviousArenaAffinity;
+	/// 当前线程进入任务区之前的CPU亲和性是否有效
+	thread_local bool PreviousArenaAffinityValid {false};
+
+	//==============================
+	// 任务区线程观察者部分
+	//==============================
+
+	/// 构造并开始观察任务区
+	ParallelExecutor::ArenaObserver::ArenaObserver(tbb::task_arena &arena, ParallelExecutor* owner,
+												   std::vector<unsigned int> cpus) :
+		tbb::task_scheduler_observer(arena), Owner(owner), CPUs(std::move(cpus))
+	{
+		observe(true);
+	}
+
+	/// 析构并停止观察
+	ParallelExecutor::ArenaObserver::~ArenaObserver()
+	{
+		observe(false);
+	}
+
+	/// 线程进入任务区事件
+	void ParallelExecutor::ArenaObserver::on_scheduler_entry(bool is_worker)
+	{
+		// 调用者线程由其自身的执行器管理，只绑定TBB工作线程
+		if (!is_worker) return;
+
+		CurrentArenaOwner = Owner;
+		if (CPUs.empty()) return;
+
+		PreviousArenaAffinityValid =
+				pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &PreviousArenaAffinity) == 0;
+
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		for (auto cpu : CPUs)
+		{
+			CPU_SET(cpu, &cpu_set);
+		}
+		if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) != 0)
+		{
+			std::cerr << "[Warning] Failed to bind arena thread to CPUs of ParallelExecutor." << std::endl;
+		}
+	}
+
+	/// 线程离开任务区事件
+	void ParallelExecutor::ArenaObserver::on_scheduler_exit(bool is_worker)
+	{
+		if (!is_worker) return;
+
+		CurrentArenaOwner = nullptr;
+		// TBB工作线程可能随后服务于其他任务区，故需恢复原有的亲和性
+		if (PreviousArenaAffinityValid)
+		{
+			pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &PreviousArenaAffinity);
+			PreviousArenaAffinityValid = false;
+		}
+	}
+
+	//==============================
+	// 并行执行器部分
+	//==============================
+
+	/// 启动执行器
+	void ParallelExecutor::Start()
+	{
+		if (IsWorking()) return;
+
+		// 回收上一次运行遗留的辅助工作者
+		HelpersLifeFlag = false;
+		for (auto& helper : HelperThreads)
+		{
+			helper.join();
+		}
+		HelperThreads.clear();
+
+		std::size_t workers_count = GetCPUAffinity().size();
+		if (workers_count == 0)
+		{
+			workers_count = std::thread::hardware_concurrency();
+		}
+		if (workers_count == 0)
+		{
+			workers_count = 1;
+		}
+
+		if (WorkerQueues.size() != workers_count)
+		{
+			// 将遗留的任务转移到公共队列中
+			for (auto& queue : WorkerQueues)
+			{
+				while (auto* workflow = queue->Tasks.PopFront())
+				{
+					Tasks.Push(workflow);
+				}
+			}
+			WorkerQueues.clear();
+			for (std::size_t index = 0; index < workers_count; ++index)
+			{
+				WorkerQueues.emplace_back(std::make_unique<WorkerQueue>());
+			}
+		}
+
+		// 任务区的并发度与工作者数量相同但不超过TBB的全局限制，并为调用者线程保留一个位置；
+		// 全局限制不允许工作线程时，任务区只由调用者线程使用
+		auto parallelism_limit = tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism);
+		auto arena_concurrency = std::max<std::size_t>(1, std::min(workers_count, parallelism_limit));
+		unsigned int arena_reserved_slots = arena_concurrency > 1 || parallelism_limit <= 1 ? 1 : 0;
+		if (!Arena || static_cast<std::size_t>(Arena->max_concurrency()) != arena_concurrency
+			|| ArenaCPUs != GetCPUAffinity())
+		{
+			ArenaThreadsObserver.reset();
+			Arena = std::make_unique<tbb::task_arena>(static_cast<int>(arena_concurrency), arena_reserved_slots);
+			Arena->initialize();
+			ArenaCPUs = GetCPUAffinity();
+			ArenaThreadsObserver = std::make_unique<ArenaObserver>(*Arena, this, ArenaCPUs);
+		}
+
+		AbstractExecutor::Start();
+
+		HelpersLifeFlag = true;
+		for (std::size_t index = 1; index < workers_count; ++index)
+		{
+			HelperThreads.emplace_back([this, index]{
+				HelperWorkingThread(index);
+			});
+		}
+	}
+
+	/// 停止执行器
+	void ParallelExecutor::Stop()
+	{
+		HelpersLifeFlag = false;
+		// 基类的停止方法将唤醒所有挂起的工作者
+		AbstractExecutor::Stop();
+	}
+
+	/// 阻塞调用线程
+	void ParallelExecutor::Join()
+	{
+		AbstractExecutor::Join();
+
+		HelpersLifeFlag = false;
+		WakeUpAllThreads();
+		for (auto& helper : HelperThreads)
+		{
+			helper.join();
+		}
+		HelperThreads.clear();
+	}
+
+	/// 辅助工作者线程
+	void ParallelExecutor::HelperWorkingThread(std::size_t worker_index)
+	{
+		PrepareCurrentThread();
+
+		CurrentWorkerOwner = this;
+		CurrentWorkerIndex = worker_index;
+
+		unsigned int idle_rounds = 0;
+		while (HelpersLifeFlag)
+		{
+			if (TryExecuteOnce(worker_index))
+			{
+				idle_rounds = 0;
+			}
+			else
+			{
+				// 无任务可执行，则按照空闲策略等待
+				Idle(idle_rounds);
+			}
+		}
+
+		CurrentWorkerOwner = nullptr;
+	}
+
 	/// 更新事件
 	void ParallelExecutor::OnUpdateWorkingThread()
 	{
-		// 判断任务列表是否为空
-		if (!this->WorkingTasks.empty())
+		if (CurrentWorkerOwner != this)
 		{
-			tbb::parallel_for_each(this->WorkingTasks.begin(), this->WorkingTasks.end(),
-					 [this](Core::AbstractWorkflow* workflow){
-				// 执行并提交
-				AbstractExecutor::InvokeWorkflow(workflow);
-			});
-			this->WorkingTasks.clear();
+			CurrentWorkerOwner = this;
+			CurrentWorkerIndex = 0;
+		}
+
+		if (TryExecuteOnce(0))
+		{
+			IdleRounds = 0;
 		}
 		else
 		{
-			this->WorkingTasksEmpty = true;
-			// 翻转
-			std::unique_lock waiting_lock(this->WaitingTasksMutex);
-			if (!this->WaitingTasks.empty())
+			// 无任务可执行，则按照空闲策略等待
+			Idle(IdleRounds);
+		}
+	}
+
+	/// 尝试执行一个任务
+	bool ParallelExecutor::TryExecuteOnce(std::size_t worker_index)
+	{
+		Core::AbstractWorkflow* workflow {nullptr};
+
+		// 优先从自身队列头部取出任务
+		auto& own_queue = *WorkerQueues[worker_index];
+		{
+			std::unique_lock lock(own_queue.Mutex);
+			workflow = own_queue.Tasks.PopFront();
+		}
+
+		// 其次从公共队列中取出任务
+		if (!workflow)
+		{
+			Tasks.TryPop(workflow);
+		}
+
+		// 最后从其他工作者的队列尾部窃取任务，窃取时不等待被占用的队列
+		for (std::size_t offset = 1; !workflow && offset < WorkerQueues.size(); ++offset)
+		{
+			auto& victim_queue = *WorkerQueues[(worker_index + offset) % WorkerQueues.size()];
+			std::unique_lock lock(victim_queue.Mutex, std::try_to_lock);
+			if (lock.owns_lock())
 			{
-				this->WorkingTasks.swap(this->WaitingTasks);
-				this->WorkingTasksEmpty = false;
-				this->WaitingTasksEmpty = true;
+				workflow = victim_queue.Tasks.PopBack();
 			}
-			waiting_lock.unlock();
+		}
 
-			// 交换后依然为空
-			if (this->WorkingTasks.empty())
+		if (!workflow) return false;
+
+		// 流处理器抛出异常时也需要减少未完成的任务数，否则执行器将永远不会为空
+		struct PendingTaskGuard
+		{
+			std::atomic_size_t& Count;
+			~PendingTaskGuard()
 			{
-				// 为空，则交出一次当前的时间片
-				std::this_thread::yield();
+				--Count;
 			}
+		} pending_task_guard {PendingTasksCount};
+
+		if (ClaimTask(workflow))
+		{
+			AbstractExecutor::InvokeWorkflow(workflow);
 		}
+
+		return true;
+	}
+
+	/// 取出最早排队的任务
+	bool ParallelExecutor::TakeOldestTask(Core::AbstractWorkflow*& workflow)
+	{
+		if (Tasks.TryPop(workflow, true))
+		{
+			--PendingTasksCount;
+			return true;
+		}
+
+		for (auto& queue : WorkerQueues)
+		{
+			std::unique_lock lock(queue->Mutex);
+			workflow = queue->Tasks.PopFront();
+			if (workflow)
+			{
+				--PendingTasksCount;
+				return true;
+			}
+		}
+		return false;
 	}
 
 	/// 提交工作流
 	void ParallelExecutor::Submit(Core::AbstractWorkflow* workflow)
 	{
-		std::unique_lock lock(WaitingTasksMutex);
-		WaitingTasks.push_back(workflow);
-		WaitingTasksEmpty = false;
+		if (!workflow)
+		{
+			throw std::runtime_error("[ParallelExecutor::Submit] Workflow Pointer is Null.");
+		}
+
+		if (!AdmitTask(workflow)) return;
+
+		++PendingTasksCount;
+
+		if (CurrentWorkerOwner == this && CurrentWorkerIndex < WorkerQueues.size())
+		{
+			auto& own_queue = *WorkerQueues[CurrentWorkerIndex];
+			std::unique_lock lock(own_queue.Mutex);
+			own_queue.Tasks.PushBack(workflow);
+		}
+		else
+		{
+			Tasks.Push(workflow);
+		}
+
+		NotifyTasks();
+	}
+
+	/// 批量提交工作流
+	void ParallelExecutor::SubmitBatch(const std::vector<Core::AbstractWorkflow *> &workflows)
+	{
+		Core::TaskChain chain;
+		for (auto* workflow : workflows)
+		{
+			if (!workflow)
+			{
+				throw std::runtime_error("[ParallelExecutor::SubmitBatch] Workflow Pointer is Null.");
+			}
+			if (AdmitTask(workflow))
+			{
+				chain.Append(workflow);
+			}
+		}
+		if (chain.Empty()) return;
+
+		PendingTasksCount += chain.Size();
+
+		if (CurrentWorkerOwner == this && CurrentWorkerIndex < WorkerQueues.size())
+		{
+			auto& own_queue = *WorkerQueues[CurrentWorkerIndex];
+			std::unique_lock lock(own_queue.Mutex);
+			own_queue.Tasks.PushBack(chain);
+		}
+		else
+		{
+			Tasks.Push(chain);
+		}
+
+		NotifyTasks(static_cast<unsigned int>(chain.Size()));
+	}
+
+	/// 并行执行循环
+	void ParallelExecutor::ParallelFor(std::size_t begin, std::size_t end,
+									   const std::function<void(std::size_t, std::size_t)> &body,
+									   std::size_t grain_size)
+	{
+		if (begin >= end) return;
+
+		if (!Arena)
+		{
+			AbstractExecutor::ParallelFor(begin, end, body, grain_size);
+			return;
+		}
+
+		auto loop = [begin, end, &body, grain_size]{
+			tbb::parallel_for(tbb::blocked_range<std::size_t>(begin, end, std::max<std::size_t>(grain_size, 1)),
+							  [&body](const tbb::blocked_range<std::size_t>& range){
+				body(range.begin(), range.end());
+			});
+		};
+
+		// 本执行器的线程所在的CPU即为任务区的CPU，可直接参与计算；
+		// TBB没有工作线程可用时，投递的任务将无人执行，也只能由调用线程计算
+		if (CurrentWorkerOwner == this || CurrentArenaOwner == this ||
+			tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism) <= 1)
+		{
+			Arena->execute(loop);
+			return;
+		}
+
+		// 其他线程只投递并等待，不参与计算
+		std::promise<void> finished;
+		auto finished_future = finished.get_future();
+		Arena->enqueue([&loop, &finished]{
+			try
+			{
+				loop();
+				finished.set_value();
+			}
+			catch (...)
+			{
+				finished.set_exception(std::current_exception());
+			}
+		});
+		finished_future.get();
 	}
 }
@@ -2,9 +2,11 @@
 
 #include "GalaxyEngine/Engine/Core/AbstractExecutor.hpp"
 
-#include <list>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
 
 namespace Galaxy
 {
@@ -13,7 +15,13 @@ namespace Galaxy
 	 * @author Vincent
 	 * @details
 	 *  ~ 该执行器将并行地执行工作流。
-	 *  ~ 注意，并行执行的工作线程默认将具备父线程的CPU亲和性。
+	 *  ~ 执行器为CPU列表中的每个处理器持有一个工作者，所有工作者线程都绑定在该执行器的CPU列表上；
+	 *    若未指定CPU列表，则工作者数量与硬件并发数相同。
+	 *  ~ 每个工作者持有自己的任务队列，工作者中提交的工作流将进入自身队列，
+	 *    外部提交的工作流将进入公共任务队列；空闲的工作者会从其他工作者的队列尾部窃取任务。
+	 *  ~ 工作者数量在启动时确定，此后修改CPU亲和性不会改变工作者数量。
+	 *  ~ 执行器持有一个与工作者数量相同并发度的TBB任务区，任务区的工作线程进入时将被绑定到启动时的CPU列表上，
+	 *    离开时恢复原有的亲和性；流处理器通过ParallelFor展开的计算只会在这些CPU上执行。
 	 */
 	class ParallelExecutor : public Core::AbstractExecutor
 	{
@@ -21,40 +29,154 @@ namespace Galaxy
 		using AbstractExecutor::AbstractExecutor;
 
 	private:
-		/// 工作任务队列
-		std::list<Core::AbstractWorkflow*> WorkingTasks;
-		/// 等候任务队列
-		std::list<Core::AbstractWorkflow*> WaitingTasks;
-		/// 等候队列互斥锁
-		mutable std::mutex WaitingTasksMutex;
-
-		/// 工作队列是否为空
-		std::atomic_bool WorkingTasksEmpty {true};
-		/// 等待队列是否为空
-		std::atomic_bool WaitingTasksEmpty {true};
+		/// 工作者任务队列
+		struct alignas(64) WorkerQueue
+		{
+			/// 队列互斥锁
+			std::mutex Mutex;
+			/// 任务队列，拥有者从头部取出，窃取者从尾部取出
+			Core::IntrusiveTaskList Tasks;
+		};
+
+		/**
+		 * @brief 任务区线程观察者
+		 * @details
+		 *  ~ TBB工作线程进入任务区时将其绑定到指定的CPU列表，离开时恢复其原有的亲和性。
+		 */
+		class ArenaObserver : public tbb::task_scheduler_observer
+		{
+		private:
+			/// 所属的并行执行器
+			ParallelExecutor* Owner;
+			/// 任务区线程需要绑定的CPU列表，为空则不绑定
+			std::vector<unsigned int> CPUs;
+
+		public:
+			/**
+			 * @brief 构造并开始观察任务区
+			 * @param arena 被观察的任务区
+			 * @param owner 所属的并行执行器
+			 * @param cpus 需要绑定的CPU列表
+			 */
+			ArenaObserver(tbb::task_arena& arena, ParallelExecutor* owner, std::vector<unsigned int> cpus);
+			/// 析构并停止观察
+			~ArenaObserver() override;
+
+			/// 线程进入任务区事件
+			void on_scheduler_entry(bool is_worker) override;
+			/// 线程离开任务区事件
+			void on_scheduler_exit(bool is_worker) override;
+		};
+
+		/// 并行循环使用的任务区
+		std::unique_ptr<tbb::task_arena> Arena;
+		/// 任务区线程观察者，须先于任务区销毁
+		std::unique_ptr<ArenaObserver> ArenaThreadsObserver;
+		/// 任务区创建时的CPU列表
+		std::vector<unsigned int> ArenaCPUs;
+
+		/// 工作者任务队列列表，下标即工作者编号，0号工作者为执行器自身的工作线程
+		std::vector<std::unique_ptr<WorkerQueue>> WorkerQueues;
+		/// 辅助工作者线程，对应1号及以后的工作者
+		std::vector<std::thread> HelperThreads;
+		/// 辅助工作者线程生命旗标
+		std::atomic_bool HelpersLifeFlag {false};
+
+		/// 尚未执行完毕的任务数，包括排队中和执行中的任务
+		std::atomic_size_t PendingTasksCount {0};
+
+		/// 0号工作者连续空闲的次数
+		unsigned int IdleRounds {0};
+
+		/**
+		 * @brief 尝试执行一个任务
+		 * @param worker_index 工作者编号
+		 * @retval true 执行了一个任务
+		 * @retval false 没有找到可执行的任务
+		 * @details
+		 *  ~ 按照自身队列、公共队列、其他工作者队列的顺序寻找任务。
+		 */
+		bool TryExecuteOnce(std::size_t worker_index);
+
+		/**
+		 * @brief 辅助工作者线程函数
+		 * @param worker_index 工作者编号
+		 */
+		void HelperWorkingThread(std::size_t worker_index);
 
 	public:
+		/**
+		 * @brief 启动执行器
+		 * @details
+		 *  ~ 将启动执行器自身的工作线程和辅助工作者线程。
+		 */
+		void Start() override;
+
+		/**
+		 * @brief 停止执行器
+		 * @details
+		 *  ~ 将同时要求辅助工作者线程停止。
+		 */
+		void Stop() override;
+
+		/**
+		 * @brief 阻塞调用线程
+		 * @details
+		 *  ~ 工作线程结束后，辅助工作者线程也将被停止并回收。
+		 */
+		void Join() override;
+
 		/**
 		 * @brief 提交工作流
-		 * @param pipeline 工作流指针
+		 * @param workflow 工作流指针
+		 * @throw std::runtime_error 当工作流指针为空指针
 		 * @details
-		 *  ~ 由于并发处理器使用了交换链，故此处需要重载，以将等待执行的工作流提交到交换链中。
+		 *  ~ 在本执行器的工作者线程中提交时，工作流将进入该工作者的队列，从而尽快地被该工作者或空闲的工作者执行。
+		 *  ~ 在其他线程中提交时，工作流将进入公共任务队列。
 		 */
 		void Submit(Core::AbstractWorkflow* workflow) override;
 
+		/**
+		 * @brief 批量提交工作流
+		 * @param workflows 将要被执行的工作流列表
+		 * @throw std::runtime_error 当列表中存在空指针
+		 * @details
+		 *  ~ 工作流进入的队列与提交方法相同，但整批工作流只加锁或入队一次，并一次性唤醒至多相同数量的工作者。
+		 */
+		void SubmitBatch(const std::vector<Core::AbstractWorkflow*>& workflows) override;
+
+		/**
+		 * @brief 并行执行循环
+		 * @param begin 起始下标
+		 * @param end 结束下标，不包含在内
+		 * @param body 循环体，参数为分得的子区间[起始, 结束)
+		 * @param grain_size 子区间的最小长度
+		 * @details
+		 *  ~ 在本执行器的工作者或任务区线程中调用时，调用线程将参与计算；
+		 *    在其他线程中调用时，调用线程只等待计算完成，以保证计算不会溢出到其他CPU上。
+		 *  ~ 执行器尚未启动时，将在调用线程中串行执行。
+		 *  ~ 循环体抛出的异常将被传递给调用者。
+		 */
+		void ParallelFor(std::size_t begin, std::size_t end,
+						 const std::function<void(std::size_t, std::size_t)>& body,
+						 std::size_t grain_size = 1) override;
+
 	protected:
-		/// 更新事件
+		/// 更新事件，作为0号工作者执行一个任务
 		void OnUpdateWorkingThread() override;
 
+		/// 取出最早排队的任务，将依次查找公共队列和各工作者队列的头部
+		bool TakeOldestTask(Core::AbstractWorkflow*& workflow) override;
+
 	public:
 		/**
-		 * @brief 返回等待任务列表是否为空
-		 * @retval true 等待列表为空
-		 * @retval false 等待列表非空
+		 * @brief 返回是否没有尚未执行完毕的任务
+		 * @retval true 所有任务均已执行完毕
+		 * @retval false 存在排队中或执行中的任务
 		 */
 		bool IsEmpty() const override
 		{
-			return WaitingTasksEmpty && WorkingTasksEmpty;
+			return PendingTasksCount == 0;
 		}
 	};
 }
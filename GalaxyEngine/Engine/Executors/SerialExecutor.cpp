@@ -8,12 +8,12 @@ namespace Galaxy
 	void SerialExecutor::OnUpdateWorkingThread()
 	{
 		// 判断任务列表是否为空
-		if (!this->Tasks.empty())
+		if (!this->Tasks.Empty())
 		{
-			while(!this->Tasks.empty())
+			while(!this->Tasks.Empty())
 			{
 				Core::AbstractWorkflow* workflow {nullptr};
-				if (this->Tasks.try_pop(workflow))
+				if (this->Tasks.TryPop(workflow) && ClaimTask(workflow))
 				{
 					AbstractExecutor::InvokeWorkflow(workflow);
 				}
@@ -21,8 +21,16 @@ namespace Galaxy
 		}
 		else
 		{
-			// 为空，则交出一次当前的时间片
-			std::this_thread::yield();
+			// 为空，则按照空闲策略等待
+			Idle(IdleRounds);
+			return;
 		}
+		IdleRounds = 0;
+	}
+
+	/// 批量提交工作流
+	void SerialExecutor::SubmitBatch(const std::vector<Core::AbstractWorkflow *> &workflows)
+	{
+		SubmitBatchToTasks(workflows);
 	}
 }
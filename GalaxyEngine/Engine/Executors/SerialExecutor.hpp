@@ -15,6 +15,19 @@ namespace Galaxy
 	public:
 		using AbstractExecutor::AbstractExecutor;
 
+		/**
+		 * @brief 批量提交工作流
+		 * @param workflows 将要被执行的工作流列表
+		 * @throw std::runtime_error 当列表中存在空指针
+		 * @details
+		 *  ~ 被接纳的工作流将被串联后一次性放入任务队列，并只唤醒一次工作线程。
+		 */
+		void SubmitBatch(const std::vector<Core::AbstractWorkflow*>& workflows) override;
+
+	private:
+		/// 工作线程连续空闲的次数
+		unsigned int IdleRounds {0};
+
 	protected:
 		/// 更新事件，将从队列中取出一个工作流并执行
 		void OnUpdateWorkingThread() override;
@@ -0,0 +1,369 @@
+#include "TimerExecutor.hpp"
+#include "GalaxyEngine/Engine/Core/AbstractWorkflow.hpp"
+#include "GalaxyEngine/Engine/Core/Tools/WorkflowAccess.hpp"
+#include "GalaxyEngine/Engine/Processors/TimedAction.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <sys/timerfd.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace Galaxy
+{
+	/// 默认构造函数
+	TimerExecutor::TimerExecutor() : AbstractExecutor()
+	{
+		CreateDescriptors();
+		SetMaxInlineHops(0);
+	}
+
+	/// 设置CPU亲和性的构造函数
+	TimerExecutor::TimerExecutor(std::initializer_list<unsigned int> cpus) : AbstractExecutor(cpus)
+	{
+		CreateDescriptors();
+		SetMaxInlineHops(0);
+	}
+
+	/// 析构函数
+	TimerExecutor::~TimerExecutor()
+	{
+		if (PollDescriptor >= 0)
+		{
+			close(PollDescriptor);
+		}
+		if (TimerDescriptor >= 0)
+		{
+			close(TimerDescriptor);
+		}
+	}
+
+	/// 创建定时器和epoll文件描述符
+	void TimerExecutor::CreateDescriptors()
+	{
+		TimerDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+		if (TimerDescriptor < 0)
+		{
+			throw std::runtime_error("[TimerExecutor::TimerExecutor] Failed to Create Timer.");
+		}
+
+		PollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+		if (PollDescriptor < 0)
+		{
+			close(TimerDescriptor);
+			throw std::runtime_error("[TimerExecutor::TimerExecutor] Failed to Create Epoll.");
+		}
+
+		epoll_event event {};
+		event.events = EPOLLIN;
+		event.data.fd = TimerDescriptor;
+		if (epoll_ctl(PollDescriptor, EPOLL_CTL_ADD, TimerDescriptor, &event) != 0)
+		{
+			close(PollDescriptor);
+			close(TimerDescriptor);
+			throw std::runtime_error("[TimerExecutor::TimerExecutor] Failed to Watch Timer.");
+		}
+	}
+
+	/// 将时间转换为刻度
+	std::uint64_t TimerExecutor::ToTick(std::chrono::steady_clock::time_point time) const
+	{
+		if (time <= OriginTime) return 0;
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - OriginTime);
+		return static_cast<std::uint64_t>((elapsed + TickInterval - std::chrono::nanoseconds(1)) / TickInterval);
+	}
+
+	/// 插入计时项
+	void TimerExecutor::InsertEntry(TimerEntry entry)
+	{
+		if (entry.DueTick <= CurrentTick)
+		{
+			CollectExpiredEntry(entry);
+			return;
+		}
+
+		// 超出时间轮范围的计时项暂时放在最高层的最远槽位，级联时将重新计算位置
+		constexpr std::uint64_t wheel_range = 1ull << (SlotBits * WheelLevels);
+		std::uint64_t slot_tick = std::min(entry.DueTick, CurrentTick + wheel_range - 1);
+		std::uint64_t delta = slot_tick - CurrentTick;
+
+		unsigned int level = 0;
+		while (level + 1 < WheelLevels && delta >= (1ull << (SlotBits * (level + 1))))
+		{
+			++level;
+		}
+
+		auto slot = (slot_tick >> (SlotBits * level)) & (SlotsPerLevel - 1);
+		Wheel[level][slot].push_back(std::move(entry));
+		++WheelEntriesCount;
+	}
+
+	/// 收集到期的计时项
+	void TimerExecutor::CollectExpiredEntry(TimerEntry &entry)
+	{
+		if (entry.Workflow)
+		{
+			ExpiredWorkflows.push_back(entry.Workflow);
+		}
+		else
+		{
+			ExpiredCallbacks.push_back(std::move(entry.Callback));
+		}
+	}
+
+	/// 推进时间轮
+	void TimerExecutor::AdvanceTo(std::uint64_t target_tick)
+	{
+		while (CurrentTick < target_tick)
+		{
+			// 时间轮为空时直接跳转
+			if (WheelEntriesCount == 0)
+			{
+				CurrentTick = target_tick;
+				break;
+			}
+
+			++CurrentTick;
+
+			// 低层槽位轮转一圈时，将高层对应槽位的计时项级联到低层
+			for (unsigned int level = 1; level < WheelLevels; ++level)
+			{
+				if (CurrentTick & ((1ull << (SlotBits * level)) - 1)) break;
+
+				auto& slot = Wheel[level][(CurrentTick >> (SlotBits * level)) & (SlotsPerLevel - 1)];
+				CascadingEntries.clear();
+				CascadingEntries.swap(slot);
+				WheelEntriesCount -= CascadingEntries.size();
+				for (auto& entry : CascadingEntries)
+				{
+					InsertEntry(std::move(entry));
+				}
+			}
+
+			// 收集第0层当前槽位中到期的计时项
+			auto& slot = Wheel[0][CurrentTick & (SlotsPerLevel - 1)];
+			for (auto& entry : slot)
+			{
+				CollectExpiredEntry(entry);
+			}
+			WheelEntriesCount -= slot.size();
+			slot.clear();
+		}
+	}
+
+	/// 查找下一个需要处理的刻度
+	std::optional<std::uint64_t> TimerExecutor::FindNextTick() const
+	{
+		if (WheelEntriesCount == 0) return std::nullopt;
+
+		std::optional<std::uint64_t> next_tick;
+		for (unsigned int level = 0; level < WheelLevels; ++level)
+		{
+			auto shift = SlotBits * level;
+			for (std::uint64_t offset = 1; offset <= SlotsPerLevel; ++offset)
+			{
+				auto block = (CurrentTick >> shift) + offset;
+				if (!Wheel[level][block & (SlotsPerLevel - 1)].empty())
+				{
+					auto tick = block << shift;
+					if (!next_tick || tick < *next_tick)
+					{
+						next_tick = tick;
+					}
+					break;
+				}
+			}
+		}
+		return next_tick;
+	}
+
+	/// 设置定时器
+	void TimerExecutor::ArmTimer(std::chrono::steady_clock::time_point time)
+	{
+		auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+		// 全零的时间将解除定时器，故至少为1纳秒
+		nanoseconds = std::max<std::int64_t>(nanoseconds, 1);
+
+		itimerspec specification {};
+		specification.it_value.tv_sec = static_cast<time_t>(nanoseconds / 1000000000);
+		specification.it_value.tv_nsec = static_cast<long>(nanoseconds % 1000000000);
+		timerfd_settime(TimerDescriptor, TFD_TIMER_ABSTIME, &specification, nullptr);
+	}
+
+	/// 唤醒工作线程
+	void TimerExecutor::WakeUpTimer()
+	{
+		WakeUpRequested = true;
+		ArmTimer(std::chrono::steady_clock::now());
+	}
+
+	/// 停止执行器
+	void TimerExecutor::Stop()
+	{
+		AbstractExecutor::Stop();
+		WakeUpTimer();
+	}
+
+	/// 提交工作流
+	void TimerExecutor::Submit(Core::AbstractWorkflow *workflow)
+	{
+		if (!workflow)
+		{
+			throw std::runtime_error("[TimerExecutor::Submit] Workflow Pointer is Null.");
+		}
+
+		if (!AdmitTask(workflow)) return;
+
+		auto due_time = std::chrono::steady_clock::now();
+		auto* timed_action = dynamic_cast<BuiltIn::TimedAction*>(
+				Core::Tools::WorkflowAccess::GetNextProcessor(workflow));
+		if (timed_action)
+		{
+			due_time = timed_action->ScheduleDueTime();
+		}
+
+		++ParkedWorkflowsCount;
+		Core::Tools::WorkflowAccess::GetTaskLink(workflow)->DueTime = due_time;
+		Tasks.Push(workflow);
+
+		// 先放入请求再检查等待状态，与工作线程先设置等待状态再检查请求相对应，保证不会错过唤醒
+		if (WaitingOnTimer)
+		{
+			WakeUpTimer();
+		}
+	}
+
+	/// 预约到期回调
+	void TimerExecutor::ScheduleCallback(std::chrono::steady_clock::time_point due_time, std::function<void()> callback)
+	{
+		++ParkedWorkflowsCount;
+		NewCallbackRequests.push({due_time, std::move(callback)});
+
+		if (WaitingOnTimer)
+		{
+			WakeUpTimer();
+		}
+	}
+
+	/// 监视文件描述符
+	void TimerExecutor::WatchDescriptor(int descriptor, bool writable, std::function<void()> callback)
+	{
+		std::unique_lock lock(DescriptorWatchersMutex);
+		if (!DescriptorWatchers.emplace(descriptor, std::move(callback)).second)
+		{
+			throw std::runtime_error("[TimerExecutor::WatchDescriptor] Descriptor is Already Being Watched.");
+		}
+
+		// 一次性监视，就绪后由工作线程移出epoll
+		epoll_event event {};
+		event.events = (writable ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+		event.data.fd = descriptor;
+		if (epoll_ctl(PollDescriptor, EPOLL_CTL_ADD, descriptor, &event) != 0)
+		{
+			DescriptorWatchers.erase(descriptor);
+			throw std::runtime_error("[TimerExecutor::WatchDescriptor] Failed to Watch Descriptor.");
+		}
+		++ParkedWorkflowsCount;
+	}
+
+	/// 等待事件
+	void TimerExecutor::WaitForEvents()
+	{
+		constexpr int max_events = 16;
+		epoll_event events[max_events];
+		int count = epoll_wait(PollDescriptor, events, max_events, -1);
+
+		for (int index = 0; index < count; ++index)
+		{
+			int descriptor = events[index].data.fd;
+			if (descriptor == TimerDescriptor)
+			{
+				std::uint64_t expirations {0};
+				[[maybe_unused]] auto bytes = read(TimerDescriptor, &expirations, sizeof(expirations));
+				continue;
+			}
+
+			std::unique_lock lock(DescriptorWatchersMutex);
+			auto finder = DescriptorWatchers.find(descriptor);
+			if (finder != DescriptorWatchers.end())
+			{
+				ExpiredCallbacks.push_back(std::move(finder->second));
+				DescriptorWatchers.erase(finder);
+			}
+			epoll_ctl(PollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+		}
+	}
+
+	/// 收集新的请求
+	void TimerExecutor::CollectNewRequests()
+	{
+		Core::AbstractWorkflow* workflow {nullptr};
+		while (Tasks.TryPop(workflow))
+		{
+			InsertEntry({ToTick(Core::Tools::WorkflowAccess::GetTaskLink(workflow)->DueTime), workflow, {}});
+		}
+
+		CallbackRequest request {};
+		while (NewCallbackRequests.try_pop(request))
+		{
+			InsertEntry({ToTick(request.DueTime), nullptr, std::move(request.Callback)});
+		}
+	}
+
+	/// 更新事件
+	void TimerExecutor::OnUpdateWorkingThread()
+	{
+		CollectNewRequests();
+
+		// 推进到当前时刻，当前时刻按照刻度向下取整，保证到期的计时项不会被提前处理
+		auto now = std::chrono::steady_clock::now();
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - OriginTime);
+		AdvanceTo(static_cast<std::uint64_t>(elapsed / TickInterval));
+
+		// 执行到期的回调和工作流，执行期间可能会有新的工作流被提交给自身，故先转移到局部列表
+		if (!ExpiredCallbacks.empty())
+		{
+			ExecutingCallbacks.clear();
+			ExecutingCallbacks.swap(ExpiredCallbacks);
+			for (auto& callback : ExecutingCallbacks)
+			{
+				--ParkedWorkflowsCount;
+				callback();
+			}
+			return;
+		}
+		if (!ExpiredWorkflows.empty())
+		{
+			ExecutingWorkflows.clear();
+			ExecutingWorkflows.swap(ExpiredWorkflows);
+			for (auto* workflow : ExecutingWorkflows)
+			{
+				--ParkedWorkflowsCount;
+				if (ClaimTask(workflow))
+				{
+					AbstractExecutor::InvokeWorkflow(workflow);
+				}
+			}
+			return;
+		}
+
+		// 等待下一个需要处理的刻度，没有计时项时按照空闲策略的挂起时长等待，以便检查停止条件
+		WaitingOnTimer = true;
+		auto next_tick = FindNextTick();
+		if (next_tick)
+		{
+			ArmTimer(OriginTime + TickInterval * static_cast<std::int64_t>(*next_tick));
+		}
+		else
+		{
+			ArmTimer(now + GetIdlePolicy().ParkTimeout);
+		}
+		if (Tasks.Empty() && NewCallbackRequests.empty() && !WakeUpRequested.exchange(false))
+		{
+			WaitForEvents();
+		}
+		WaitingOnTimer = false;
+	}
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "GalaxyEngine/Engine/Core/AbstractExecutor.hpp"
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <initializer_list>
+#include <tbb/tbb.h>
+
+namespace Galaxy
+{
+	/**
+	 * @brief 计时执行器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该执行器用于执行定时动作，例如休眠动作、限速动作和周期提交动作。
+	 *  ~ 提交到该执行器的工作流若即将执行定时动作，则将被停放在分层时间轮中直至到期，期间不占用任何线程；
+	 *    否则将被立即执行。
+	 *  ~ 工作流的到期时间记录在其任务链接节点中，随后通过侵入式任务队列交给工作线程，提交不加锁也不分配内存；
+	 *    时间轮槽位和到期列表的存储在清空后保留，容量达到停放的峰值后不再分配内存。
+	 *  ~ 工作线程通过timerfd等待下一个到期时刻，到期时间按照刻度向上取整，故不会提前执行。
+	 *  ~ 到期的工作流在工作线程中执行，故该执行器上只应当放置定时动作和轻量的操作。
+	 *  ~ 该执行器不会连续直接执行同一工作流，以保证相邻的定时动作各自生效。
+	 *  ~ 该执行器还可以在到期时或文件描述符就绪时调用回调，供计时和文件描述符可等待对象使用；
+	 *    工作线程通过epoll同时等待timerfd和被监视的文件描述符，回调同样在工作线程中执行。
+	 */
+	class TimerExecutor : public Core::AbstractExecutor
+	{
+	private:
+		/// 每层时间轮槽位数的二进制位数
+		static constexpr unsigned int SlotBits = 6;
+		/// 每层时间轮的槽位数
+		static constexpr std::uint64_t SlotsPerLevel = 1ull << SlotBits;
+		/// 时间轮层数
+		static constexpr unsigned int WheelLevels = 4;
+
+		/// 回调请求，由预约者放入，工作线程取出
+		struct CallbackRequest
+		{
+			/// 到期时间
+			std::chrono::steady_clock::time_point DueTime;
+			/// 到期回调
+			std::function<void()> Callback;
+		};
+
+		/// 时间轮中的计时项
+		struct TimerEntry
+		{
+			/// 到期刻度
+			std::uint64_t DueTick;
+			/// 工作流指针，为空时表示回调计时项
+			Core::AbstractWorkflow* Workflow;
+			/// 到期回调
+			std::function<void()> Callback;
+		};
+
+		/// 新预约的回调请求，回调本身即需要分配内存，故不使用侵入式队列
+		tbb::concurrent_queue<CallbackRequest> NewCallbackRequests;
+		/// 停放中的工作流数量，包括尚未放入时间轮的请求，以及等待中的回调
+		std::atomic_size_t ParkedWorkflowsCount {0};
+
+		/// 分层时间轮，仅由工作线程访问
+		std::array<std::array<std::vector<TimerEntry>, SlotsPerLevel>, WheelLevels> Wheel;
+		/// 时间轮中的计时项数量
+		std::size_t WheelEntriesCount {0};
+		/// 时间轮当前刻度
+		std::uint64_t CurrentTick {0};
+		/// 级联中的计时项，与被级联的槽位交换存储
+		std::vector<TimerEntry> CascadingEntries;
+		/// 已到期等待执行的工作流
+		std::vector<Core::AbstractWorkflow*> ExpiredWorkflows;
+		/// 正在执行的到期工作流，与到期列表交换存储
+		std::vector<Core::AbstractWorkflow*> ExecutingWorkflows;
+		/// 已到期或文件描述符已就绪，等待执行的回调
+		std::vector<std::function<void()>> ExpiredCallbacks;
+		/// 正在执行的到期回调，与到期列表交换存储
+		std::vector<std::function<void()>> ExecutingCallbacks;
+
+		/// 刻度零点
+		std::chrono::steady_clock::time_point OriginTime {std::chrono::steady_clock::now()};
+		/// 刻度间隔
+		std::chrono::nanoseconds TickInterval {std::chrono::milliseconds(1)};
+
+		/// 定时器文件描述符
+		int TimerDescriptor {-1};
+		/// epoll文件描述符，同时等待定时器和被监视的文件描述符
+		int PollDescriptor {-1};
+
+		/// 被监视的文件描述符及其就绪回调
+		std::unordered_map<int, std::function<void()>> DescriptorWatchers;
+		/// 监视表互斥量
+		std::mutex DescriptorWatchersMutex;
+		/// 工作线程是否即将或正在等待定时器
+		std::atomic_bool WaitingOnTimer {false};
+		/// 是否要求工作线程立即醒来
+		std::atomic_bool WakeUpRequested {false};
+
+		/// 将时间转换为刻度，向上取整
+		[[nodiscard]] std::uint64_t ToTick(std::chrono::steady_clock::time_point time) const;
+
+		/**
+		 * @brief 插入计时项
+		 * @details
+		 *  ~ 已经到期的计时项将直接放入到期列表。
+		 */
+		void InsertEntry(TimerEntry entry);
+
+		/// 将到期的计时项放入对应的到期列表
+		void CollectExpiredEntry(TimerEntry& entry);
+
+		/**
+		 * @brief 推进时间轮
+		 * @param target_tick 目标刻度
+		 * @details
+		 *  ~ 逐刻推进，在低层槽位轮转一圈时将高层槽位中的计时项级联到低层，并收集到期的计时项。
+		 */
+		void AdvanceTo(std::uint64_t target_tick);
+
+		/**
+		 * @brief 查找下一个需要处理的刻度
+		 * @return 下一个有计时项到期或需要级联的刻度，时间轮为空时返回std::nullopt
+		 */
+		[[nodiscard]] std::optional<std::uint64_t> FindNextTick() const;
+
+		/// 设置定时器在指定时间触发
+		void ArmTimer(std::chrono::steady_clock::time_point time);
+
+		/// 唤醒正在等待定时器的工作线程
+		void WakeUpTimer();
+
+		/**
+		 * @brief 创建定时器和epoll文件描述符
+		 * @throw std::runtime_error 当创建失败
+		 */
+		void CreateDescriptors();
+
+		/// 等待定时器或被监视的文件描述符就绪，并收集就绪的回调
+		void WaitForEvents();
+
+		/// 将新提交的工作流和新预约的回调放入时间轮
+		void CollectNewRequests();
+
+	public:
+		/// 默认构造函数
+		TimerExecutor();
+
+		/**
+		 * @brief 设置CPU亲和性的构造函数
+		 * @param cpus 处理器编号列表
+		 */
+		TimerExecutor(std::initializer_list<unsigned int> cpus);
+
+		/// 析构函数，将关闭定时器和epoll文件描述符
+		~TimerExecutor();
+
+		/**
+		 * @brief 设置刻度间隔
+		 * @param interval 刻度间隔
+		 * @details
+		 *  ~ 应当在执行器启动前设置，间隔越小则定时越精确，但长时间停放的工作流需要更多的级联。
+		 */
+		void SetTickInterval(std::chrono::nanoseconds interval)
+		{
+			TickInterval = interval;
+		}
+
+		/**
+		 * @brief 获取刻度间隔
+		 * @return 刻度间隔
+		 */
+		[[nodiscard]] std::chrono::nanoseconds GetTickInterval() const
+		{
+			return TickInterval;
+		}
+
+		/**
+		 * @brief 停止执行器
+		 * @details
+		 *  ~ 将唤醒正在等待定时器的工作线程。
+		 */
+		void Stop() override;
+
+		/**
+		 * @brief 提交工作流
+		 * @param workflow 工作流指针
+		 * @throw std::runtime_error 当工作流指针为空指针
+		 * @details
+		 *  ~ 若工作流即将执行定时动作，则将按照该动作给出的到期时间停放，否则将尽快执行。
+		 */
+		void Submit(Core::AbstractWorkflow* workflow) override;
+
+		/**
+		 * @brief 预约到期回调
+		 * @param due_time 到期时间
+		 * @param callback 回调，将在到期后于工作线程中调用一次
+		 */
+		void ScheduleCallback(std::chrono::steady_clock::time_point due_time, std::function<void()> callback);
+
+		/**
+		 * @brief 监视文件描述符
+		 * @param descriptor 文件描述符
+		 * @param writable 为true时等待可写，否则等待可读
+		 * @param callback 回调，将在文件描述符就绪后于工作线程中调用一次，随后停止监视
+		 * @throw std::runtime_error 当该文件描述符已被监视，或无法加入epoll
+		 */
+		void WatchDescriptor(int descriptor, bool writable, std::function<void()> callback);
+
+		/**
+		 * @brief 查询是否没有停放中的工作流
+		 * @retval true 没有停放中的工作流
+		 * @retval false 存在停放中的工作流
+		 */
+		[[nodiscard]] bool IsEmpty() const override
+		{
+			return ParkedWorkflowsCount == 0;
+		}
+
+	protected:
+		/// 更新事件，将执行到期的工作流并等待下一个到期时刻
+		void OnUpdateWorkingThread() override;
+
+		/**
+		 * @brief 取出最早排队的任务
+		 * @retval false 总是失败
+		 * @details
+		 *  ~ 任务队列只用于将工作流交给工作线程，停放中的工作流须在到期后执行，不会因队列已满而被放弃。
+		 */
+		bool TakeOldestTask(Core::AbstractWorkflow*&) override
+		{
+			return false;
+		}
+	};
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <utility>
+
+namespace Galaxy
+{
+	namespace Core
+	{
+		class AbstractWorkflow;
+	}
+
+	/**
+	 * @brief 工作流条件变量
+	 * @author Vincent
+	 * @details
+	 *  ~ 供等待条件动作和通知条件动作使用的通道值，须配合互斥量通道使用，所有操作都应当在持有该互斥量时进行。
+	 *  ~ 等待的工作流被停放在工作流等待区，不占用任何执行器线程；通知时将一次性取出所有等待者，批量唤醒。
+	 *  ~ 停放时记录工作流的等待代数，唤醒只结束登记时的那一次等待。
+	 *  ~ 无法挂起的工作流，例如依赖图模式和流水线模式下的工作流，仍然在线程中阻塞等待。
+	 */
+	class WorkflowConditionVariable
+	{
+	private:
+		/// 停放在等待区中的工作流及其等待代数
+		std::vector<std::pair<Core::AbstractWorkflow*, std::uint64_t>> ParkedWorkflows;
+		/// 在线程中阻塞等待的条件变量
+		std::condition_variable BlockingCondition;
+
+	public:
+		/**
+		 * @brief 登记停放的工作流
+		 * @param workflow 已被挂起，即将进入等待区的工作流
+		 * @param generation 工作流即将进入的等待的代数
+		 */
+		void Enlist(Core::AbstractWorkflow* workflow, std::uint64_t generation)
+		{
+			ParkedWorkflows.emplace_back(workflow, generation);
+		}
+
+		/**
+		 * @brief 在线程中阻塞等待
+		 * @param lock 已经锁定的互斥量锁
+		 * @param predicate 苏醒条件
+		 */
+		template<typename Predicate>
+		void Wait(std::unique_lock<std::mutex>& lock, Predicate predicate)
+		{
+			BlockingCondition.wait(lock, predicate);
+		}
+
+		/**
+		 * @brief 通知所有等待者
+		 * @return 停放的工作流及其等待代数，需要由调用者在释放互斥量后通过等待区唤醒
+		 * @details
+		 *  ~ 阻塞等待的线程将被直接唤醒。
+		 */
+		std::vector<std::pair<Core::AbstractWorkflow*, std::uint64_t>> NotifyAll()
+		{
+			BlockingCondition.notify_all();
+			std::vector<std::pair<Core::AbstractWorkflow*, std::uint64_t>> workflows;
+			workflows.swap(ParkedWorkflows);
+			return workflows;
+		}
+	};
+}
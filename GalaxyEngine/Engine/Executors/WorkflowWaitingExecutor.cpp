@@ -1,33 +1,174 @@
 #include "WorkflowWaitingExecutor.hpp"
 #include "../Core/Tools/WorkflowAccess.hpp"
 
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 namespace Galaxy
 {
+	namespace
+	{
+		/// 将已被唤醒的工作流按照下一个流处理器的执行器分组，每组通过一次批量提交放入执行器的队列
+		void ResumeBatch(const std::vector<Core::AbstractWorkflow*>& workflows)
+		{
+			std::vector<std::pair<Core::AbstractExecutor*, std::vector<Core::AbstractWorkflow*>>> batches;
+			for (auto* workflow : workflows)
+			{
+				auto next_executor = Core::Tools::WorkflowAccess::Join(workflow);
+				if (!next_executor) continue;
+
+				auto finder = std::find_if(batches.begin(), batches.end(), [executor = *next_executor](const auto& batch){
+					return batch.first == executor;
+				});
+				if (finder == batches.end())
+				{
+					batches.emplace_back(*next_executor, std::vector<Core::AbstractWorkflow*>{});
+					finder = std::prev(batches.end());
+				}
+				finder->second.push_back(workflow);
+			}
+
+			for (const auto& [executor, batch] : batches)
+			{
+				executor->SubmitBatch(batch);
+			}
+		}
+	}
+
+	/// 恢复工作流
+	void WorkflowWaitingExecutor::Resume(Core::AbstractWorkflow *workflow)
+	{
+		if (auto next_executor = Core::Tools::WorkflowAccess::Join(workflow))
+		{
+			(*next_executor)->Submit(workflow);
+		}
+	}
+
 	/// 提交
 	void WorkflowWaitingExecutor::Submit(Core::AbstractWorkflow *workflow)
 	{
-		auto awaken_finder = AwakenWorkflows.find(workflow);
-		if (awaken_finder != AwakenWorkflows.end())
+		auto& state_word = Core::Tools::WorkflowAccess::GetWaitingStateWord(workflow);
+		auto current = state_word.load(std::memory_order_acquire);
+		while (true)
 		{
-			Core::Tools::WorkflowAccess::IterateExecute(*awaken_finder);
-			AwakenWorkflows.unsafe_erase(awaken_finder);
-			return;
+			switch (GetState(current))
+			{
+				case WaitingState::Running:
+					if (state_word.compare_exchange_weak(current, WithState(current, WaitingState::Waiting),
+					                                     std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						return;
+					}
+					break;
+				case WaitingState::Awakened:
+					// 唤醒消息已经到达，本次等待立即结束
+					if (state_word.compare_exchange_weak(current, NextGeneration(current),
+					                                     std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						Resume(workflow);
+						return;
+					}
+					break;
+				case WaitingState::Waiting:
+				default:
+					throw std::runtime_error("[WorkflowWaitingExecutor::Submit] Workflow is Already Waiting.");
+			}
 		}
-		WaitingWorkflows.insert(workflow);
 	}
 
 	/// 唤醒
 	void WorkflowWaitingExecutor::Awake(Core::AbstractWorkflow *workflow)
 	{
-		auto waiting_finder = WaitingWorkflows.find(workflow);
-		if (waiting_finder != WaitingWorkflows.end())
+		Awake(workflow, AnyGeneration);
+	}
+
+	/// 唤醒指定代数的等待
+	void WorkflowWaitingExecutor::Awake(Core::AbstractWorkflow *workflow, std::uint64_t generation)
+	{
+		if (TryAwake(workflow, generation))
 		{
-			auto* target_executor = Core::Tools::WorkflowAccess::GetCurrentExecutor(*waiting_finder);
-			target_executor->Submit(*waiting_finder);
-			WaitingWorkflows.unsafe_erase(waiting_finder);
-			return;
+			Resume(workflow);
 		}
-		AwakenWorkflows.insert(workflow);
 	}
-}
 
+	/// 批量唤醒
+	void WorkflowWaitingExecutor::AwakeBatch(const std::vector<Core::AbstractWorkflow *> &workflows)
+	{
+		std::vector<Core::AbstractWorkflow*> awakened;
+		awakened.reserve(workflows.size());
+		for (auto* workflow : workflows)
+		{
+			if (TryAwake(workflow, AnyGeneration))
+			{
+				awakened.push_back(workflow);
+			}
+		}
+		ResumeBatch(awakened);
+	}
+
+	/// 批量唤醒指定代数的等待
+	void WorkflowWaitingExecutor::AwakeBatch(const std::vector<std::pair<Core::AbstractWorkflow *, std::uint64_t>> &tickets)
+	{
+		std::vector<Core::AbstractWorkflow*> awakened;
+		awakened.reserve(tickets.size());
+		for (const auto& [workflow, generation] : tickets)
+		{
+			if (TryAwake(workflow, generation))
+			{
+				awakened.push_back(workflow);
+			}
+		}
+		ResumeBatch(awakened);
+	}
+
+	/// 尝试唤醒
+	bool WorkflowWaitingExecutor::TryAwake(Core::AbstractWorkflow *workflow, std::uint64_t generation)
+	{
+		auto& state_word = Core::Tools::WorkflowAccess::GetWaitingStateWord(workflow);
+		auto current = state_word.load(std::memory_order_acquire);
+		while (true)
+		{
+			// 代数不符，说明该次等待已经结束，唤醒已经过期
+			if (generation != AnyGeneration && (current >> StateBits) != generation)
+			{
+				return false;
+			}
+
+			switch (GetState(current))
+			{
+				case WaitingState::Waiting:
+					if (state_word.compare_exchange_weak(current, NextGeneration(current),
+					                                     std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						return true;
+					}
+					break;
+				case WaitingState::Running:
+					if (state_word.compare_exchange_weak(current, WithState(current, WaitingState::Awakened),
+					                                     std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						return false;
+					}
+					break;
+				case WaitingState::Awakened:
+				default:
+					// 尚未进入等待前的重复唤醒只生效一次
+					return false;
+			}
+		}
+	}
+
+	/// 查询等待状态
+	auto WorkflowWaitingExecutor::GetWaitingState(Core::AbstractWorkflow *workflow) -> WaitingState
+	{
+		return GetState(Core::Tools::WorkflowAccess::GetWaitingStateWord(workflow).load(std::memory_order_acquire));
+	}
+
+	/// 查询等待代数
+	std::uint64_t WorkflowWaitingExecutor::GetWaitingGeneration(Core::AbstractWorkflow *workflow)
+	{
+		return Core::Tools::WorkflowAccess::GetWaitingStateWord(workflow).load(std::memory_order_acquire) >> StateBits;
+	}
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "../Core/AbstractExecutor.hpp"
-#include <tbb/tbb.h>
+#include <cstdint>
+#include <vector>
+#include <utility>
 
 namespace Galaxy
 {
@@ -10,14 +12,70 @@ namespace Galaxy
 	 * @author Vincent
 	 * @details
 	 *  ~ 工作流等待集合可以存储和唤醒工作流。
+	 *  ~ 等待状态存放在每个工作流自身的原子状态字中，由状态和代数组成：运行中、等待中、已被唤醒；
+	 *    进入等待和唤醒都只需一次比较交换，不需要查询哈希表，也不需要分配内存。
+	 *  ~ 唤醒先于进入等待到达时，将被记录在状态字中，工作流进入等待时立即继续执行，故不会丢失唤醒；
+	 *    进入等待前的多次唤醒只生效一次。
+	 *  ~ 每完成一次等待，代数加一，用于区分同一工作流的不同次等待。
+	 *    唤醒者可以在工作流进入等待前记下其代数，并以该代数唤醒；代数不符的唤醒属于已经结束的等待，将被忽略，
+	 *    不会使工作流的下一次无关的等待提前结束。
 	 */
 	class WorkflowWaitingExecutor : public Core::AbstractExecutor
 	{
+	public:
+		/// 不检查代数的唤醒所使用的代数
+		static constexpr std::uint64_t AnyGeneration = ~0ull;
+
+		/// 等待状态
+		enum class WaitingState : std::uint64_t
+		{
+			/// 运行中，未进入等待且未被唤醒
+			Running = 0,
+			/// 等待中，已经挂起，等待唤醒
+			Waiting = 1,
+			/// 已被唤醒，唤醒消息已经到达，但工作流尚未进入等待
+			Awakened = 2
+		};
+
 	private:
-		/// 正在等待的工作流，存放已经挂起，但工作流尚未抵达的工作流指针
-		tbb::concurrent_unordered_set<Core::AbstractWorkflow*> WaitingWorkflows;
-		/// 需要唤醒的工作流，存放唤醒消息已经到达，但工作流尚未挂起的工作流指针
-		tbb::concurrent_unordered_set<Core::AbstractWorkflow*> AwakenWorkflows;
+		/// 状态在状态字中所占的位数
+		static constexpr unsigned int StateBits = 2;
+		/// 状态掩码
+		static constexpr std::uint64_t StateMask = (1ull << StateBits) - 1;
+
+		/// 从状态字中取出状态
+		static constexpr WaitingState GetState(std::uint64_t word)
+		{
+			return static_cast<WaitingState>(word & StateMask);
+		}
+
+		/// 以状态字的代数和新的状态组成新的状态字
+		static constexpr std::uint64_t WithState(std::uint64_t word, WaitingState state)
+		{
+			return (word & ~StateMask) | static_cast<std::uint64_t>(state);
+		}
+
+		/// 结束一次等待，代数加一并回到运行中状态
+		static constexpr std::uint64_t NextGeneration(std::uint64_t word)
+		{
+			return ((word >> StateBits) + 1) << StateBits;
+		}
+
+		/**
+		 * @brief 恢复工作流
+		 * @details
+		 *  ~ 与挂起的工作流汇合，若工作流已经结束本次迭代执行，则将其提交到下一个流处理器的执行器。
+		 */
+		static void Resume(Core::AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 尝试唤醒工作流
+		 * @param workflow 工作流
+		 * @param generation 需要结束的等待的代数，为AnyGeneration时不检查
+		 * @retval true 工作流正在等待，已被唤醒，需要由调用者恢复
+		 * @retval false 工作流尚未进入等待，唤醒消息已被记录；或代数不符，唤醒已被忽略
+		 */
+		static bool TryAwake(Core::AbstractWorkflow* workflow, std::uint64_t generation);
 
 	public:
 		/// 不进行任何操作
@@ -37,18 +95,61 @@ namespace Galaxy
 		}
 
 		/**
-		 * @brief 提交工作流
+		 * @brief 提交工作流，使其进入等待
 		 * @param workflow 工作流
+		 * @throw std::runtime_error 当工作流已经在等待中
+		 * @pre 工作流已被其正在执行的流处理器以SuspendUntilJoined(1)挂起。
+		 * @details
+		 *  ~ 若唤醒消息已经到达，则工作流将立即从下一个流处理器继续执行。
 		 */
 		void Submit(Core::AbstractWorkflow *workflow) override;
 
 		/**
-		 * @brief 唤醒工作线程
+		 * @brief 唤醒工作流
 		 * @details
-		 *  ~ 将在调用线程中继续执行该工作流。
+		 *  ~ 若工作流正在等待，则将其提交到下一个流处理器的执行器；否则记录唤醒消息。
 		 */
 		virtual void Awake(Core::AbstractWorkflow *workflow);
 
+		/**
+		 * @brief 唤醒工作流的指定一次等待
+		 * @param workflow 工作流
+		 * @param generation 需要结束的等待的代数，应当在工作流进入等待前通过GetWaitingGeneration获取
+		 * @details
+		 *  ~ 仅当工作流的代数与之相同时生效；重复或迟到的唤醒不会影响工作流之后的等待。
+		 */
+		virtual void Awake(Core::AbstractWorkflow *workflow, std::uint64_t generation);
+
+		/**
+		 * @brief 批量唤醒工作流
+		 * @param workflows 需要唤醒的工作流
+		 * @details
+		 *  ~ 正在等待的工作流将按照下一个流处理器的执行器分组，每组通过一次批量提交放入执行器的队列。
+		 */
+		virtual void AwakeBatch(const std::vector<Core::AbstractWorkflow*>& workflows);
+
+		/**
+		 * @brief 批量唤醒工作流的指定一次等待
+		 * @param tickets 需要唤醒的工作流及其需要结束的等待的代数
+		 * @details
+		 *  ~ 代数不符的工作流将被忽略，其余同AwakeBatch。
+		 */
+		virtual void AwakeBatch(const std::vector<std::pair<Core::AbstractWorkflow*, std::uint64_t>>& tickets);
+
+		/**
+		 * @brief 查询工作流的等待状态
+		 * @param workflow 工作流
+		 * @return 工作流当前的等待状态
+		 */
+		[[nodiscard]] static WaitingState GetWaitingState(Core::AbstractWorkflow* workflow);
+
+		/**
+		 * @brief 查询工作流的等待代数
+		 * @param workflow 工作流
+		 * @return 工作流已经完成的等待次数
+		 */
+		[[nodiscard]] static std::uint64_t GetWaitingGeneration(Core::AbstractWorkflow* workflow);
+
 	protected:
 		/// 不进行任何操作
 		void OnUpdateWorkingThread() override
@@ -18,6 +18,27 @@
 #define Provide(...) {this, __VA_ARGS__}
 #endif
 
+#ifndef StaticChannel
+/**
+ * @brief 声明静态通道标签
+ * @param Type 值类型
+ * @param Symbol 标签名称，同时也是对应端口的名称
+ * @details 静态通道标签用于在静态序列中于编译期绑定通道。
+ */
+#define StaticChannel(Type, Symbol) struct Symbol { using ValueType = Type; static constexpr const char* Name = #Symbol; }
+#endif
+
+#ifndef StaticInternalChannel
+/**
+ * @brief 声明静态内部通道标签
+ * @param Type 值类型
+ * @param Symbol 标签名称
+ * @details 内部通道的值由静态序列持有，只在序列的步骤之间传递，不对应端口。
+ */
+#define StaticInternalChannel(Type, Symbol) struct Symbol { using ValueType = Type; \
+	static constexpr const char* Name = #Symbol; static constexpr bool IsInternal = true; }
+#endif
+
 //==============================
 // 端口关键词
 //==============================
@@ -40,6 +61,25 @@
 # define RequireOptional(Type, Symbol) Galaxy::Port<Type> Symbol = {#Symbol, this, true}
 #endif
 
+#ifndef RequireReadOnly
+/**
+ * @brief 声明只读的需求通道
+ * @param Type 需求类型
+ * @param Name 通道名称
+ * @details 流处理器承诺只读取该通道，依赖图模式下只读同一通道的流处理器可以同时执行。
+ */
+# define RequireReadOnly(Type, Symbol) Galaxy::Port<Type> Symbol = {#Symbol, this, false, true}
+#endif
+
+#ifndef RequireOptionalReadOnly
+/**
+ * @brief 声明可选且只读的需求通道
+ * @param Type 需求类型
+ * @param Name 通道名称
+ */
+# define RequireOptionalReadOnly(Type, Symbol) Galaxy::Port<Type> Symbol = {#Symbol, this, true, true}
+#endif
+
 
 //==============================
 // 流处理器关键词
@@ -80,6 +120,35 @@
 #define Process void Execute() override
 #endif
 
+#ifndef AwaitBegin
+/**
+ * @brief 可等待的执行过程开始标签
+ * @details
+ *  ~ 该标签之后直至AwaitEnd之间可以使用Await关键字；恢复执行时将从上次等待之后继续。
+ *  ~ 局部变量不会跨越等待保留，在两者之间声明带有初始化的局部变量且跨越Await时将无法通过编译。
+ */
+#define AwaitBegin switch (GetResumePoint()) { case 0:
+#endif
+
+#ifndef Await
+/**
+ * @brief 等待可等待对象
+ * @param Awaitable 可等待对象，其生命周期应当长于等待过程
+ * @details
+ *  ~ 对象未就绪时，执行方法将立即返回，宿主工作流离开执行器；对象完成后，将从该处继续执行。
+ *  ~ 依赖图模式和流水线模式下宿主工作流无法挂起，将在当前执行器线程中阻塞等待对象完成，等待期间占用该线程。
+ *  ~ 每行最多使用一次。
+ */
+#define Await(Awaitable) do { if (SuspendOn(Awaitable, __LINE__)) return; case __LINE__:; } while (false)
+#endif
+
+#ifndef AwaitEnd
+/**
+ * @brief 可等待的执行过程结束标签
+ */
+#define AwaitEnd }
+#endif
+
 #ifndef Configure
 /**
  * @brief 配置关键字
@@ -143,6 +212,22 @@ Galaxy::Processor((Galaxy::Core::AbstractExecutor**)(executor), (Galaxy::Core::A
 #define NeedParallelExecutor(Name) Galaxy::ParallelExecutor* Name
 #endif
 
+#ifndef NeedDeadlineExecutor
+/**
+ * @brief 需要截止期限执行器
+ * @param Name 执行器在工作流中的引用名称
+ */
+#define NeedDeadlineExecutor(Name) Galaxy::DeadlineExecutor* Name
+#endif
+
+#ifndef NeedTimerExecutor
+/**
+ * @brief 需要计时执行器
+ * @param Name 执行器在工作流中的引用名称
+ */
+#define NeedTimerExecutor(Name) Galaxy::TimerExecutor* Name
+#endif
+
 #ifndef Channels
 /**
  * @brief 通道描述部分开始标签
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../Core/AbstractProcessor.hpp"
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 分支流处理器
+	 * @author Vincent
+	 * @details
+	 *  ~ 当条件满足时，工作流将跳转至目标标签之后继续执行；目标为空时将跳转至工作流末尾，正常结束本次迭代。
+	 *  ~ 条件不满足时，工作流将继续执行下一个流处理器。
+	 *  ~ 条件需要读取通道时，应当派生流处理器并通过端口读取，再调用JumpTo方法，从而适用于流水线模式。
+	 */
+	class BranchAction : public Core::AbstractProcessor
+	{
+	public:
+		/// 跳转条件
+		std::function<bool()> Condition;
+		/// 跳转目标
+		Core::AbstractProcessor* Target {nullptr};
+
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 目标执行器
+		 * @param host 宿主
+		 * @param condition 跳转条件
+		 * @param target 跳转目标，为空时跳转至工作流末尾
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		BranchAction(ExecutorType** target_executor, WorkflowType* host,
+					 decltype(Condition) condition, Core::AbstractProcessor* target = nullptr) :
+			Core::AbstractProcessor((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host)),
+			Condition(std::move(condition)), Target(target)
+		{}
+
+	protected:
+		/// 执行方法
+		void Execute() override
+		{
+			if (Condition && Condition())
+			{
+				JumpTo(Target);
+			}
+		}
+	};
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <type_traits>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include "../../Framework/Processor.hpp"
+#include "../../Engine/Core/AbstractExecutor.hpp"
+#include "../../Engine/Core/Tools/WorkflowAccess.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 扇出工作流提交动作
+	 * @author Vincent
+	 * @details
+	 *  ~ 该动作将同时启动若干个内置子工作流实例，每个实例拥有自己的通道，适用于按图像分块或按候选区域等数据并行的处理。
+	 *  ~ 启动后父工作流将被挂起，所有实例结束后由最后结束的实例继续执行父工作流的下一个流处理器；
+	 *    汇合通过原子计数完成，不经过工作流等待区。
+	 *  ~ 子工作流实例将被提交到该动作被指定的执行器，通常为绑定了多个CPU的并行执行器。
+	 *  ~ 不适用于依赖图模式和流水线模式。
+	 */
+	template<typename WorkflowClass,
+			typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowClass>>>
+	class FanOutSubmitAction : public Core::AbstractProcessor
+	{
+	public:
+		/// 子工作流实例列表
+		using InstanceList = std::vector<std::unique_ptr<WorkflowClass>>;
+
+		/**
+		 * @brief 子工作流实例
+		 * @details
+		 *  ~ 实例数量在构造时确定，执行期间不会分配或释放实例。
+		 */
+		InstanceList SubWorkflows;
+
+		/**
+		 * @brief 分发函数器
+		 * @details
+		 *  ~ 参数为子工作流实例列表，返回本次需要启动的实例数量，超出实例总数的部分将被忽略。
+		 *  ~ 在父工作流的线程中执行，通常用于将图像分块或候选区域写入前若干个实例的通道。
+		 *  ~ 为空时将启动所有实例。
+		 */
+		std::function<std::size_t(InstanceList&)> Scatter {};
+
+		/**
+		 * @brief 汇总函数器
+		 * @details
+		 *  ~ 参数为子工作流实例列表和本次启动的实例数量。
+		 *  ~ 在所有实例结束后、父工作流继续执行前，于最后结束的实例所在的线程中执行，通常用于将各实例的结果写回父工作流的通道。
+		 */
+		std::function<void(InstanceList&, std::size_t)> Gather {};
+
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 子工作流实例的目标执行器
+		 * @param host 宿主
+		 * @param instances_count 子工作流实例的数量
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		FanOutSubmitAction(ExecutorType** target_executor, WorkflowType* host, std::size_t instances_count) :
+			Core::AbstractProcessor((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host))
+		{
+			SubWorkflows.reserve(instances_count);
+			for (std::size_t index = 0; index < instances_count; ++index)
+			{
+				auto instance = std::make_unique<WorkflowClass>();
+				// 在结束事件中汇合，由最后结束的实例继续执行父工作流
+				instance->OnEnd = [this]{
+					OnInstanceEnd();
+				};
+				SubWorkflows.push_back(std::move(instance));
+			}
+		}
+
+	private:
+		/// 本次启动的实例数量
+		std::size_t LaunchedCount {0};
+		/// 尚未结束的实例数量
+		std::atomic_size_t RemainingCount {0};
+
+		/// 子工作流实例结束
+		void OnInstanceEnd()
+		{
+			if (RemainingCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			{
+				return;
+			}
+
+			auto* workflow = GetWorkflow();
+			if (Gather)
+			{
+				Gather(SubWorkflows, LaunchedCount);
+			}
+			if (auto next_executor = Core::Tools::WorkflowAccess::Join(workflow))
+			{
+				(*next_executor)->Submit(workflow);
+			}
+		}
+
+	protected:
+		/// 执行操作
+		void Execute() override
+		{
+			LaunchedCount = Scatter ? std::min(Scatter(SubWorkflows), SubWorkflows.size()) : SubWorkflows.size();
+
+			if (LaunchedCount == 0)
+			{
+				if (Gather)
+				{
+					Gather(SubWorkflows, 0);
+				}
+				return;
+			}
+
+			// 所有实例结束后只需汇合一次，须在启动实例之前设置
+			RemainingCount.store(LaunchedCount, std::memory_order_relaxed);
+			SuspendUntilJoined(1);
+			for (std::size_t index = 0; index < LaunchedCount; ++index)
+			{
+				(*GetExecutor())->Submit(SubWorkflows[index].get());
+			}
+		}
+	};
+}
@@ -0,0 +1,10 @@
+#include "Label.hpp"
+#include "../Runtime.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/// 构造函数
+	Label::Label(Core::AbstractWorkflow *host) :
+		Core::AbstractProcessor(&Runtime::GetInstance()->CurrentExecutorPointer, host)
+	{}
+}
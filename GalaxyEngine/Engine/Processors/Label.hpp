@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../Core/AbstractProcessor.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 标签流处理器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该流处理器不执行任何操作，仅作为跳转的目标；跳转后工作流将从标签之后的流处理器继续执行。
+	 *  ~ 标签在当前线程中执行，顺序经过标签时不会发生执行器切换。
+	 */
+	class Label : public Core::AbstractProcessor
+	{
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param host 宿主工作流
+		 * @details
+		 *  ~ 标签将绑定到运行时的当前执行器，不需要指定执行器。
+		 */
+		explicit Label(Core::AbstractWorkflow* host);
+
+	protected:
+		/// 执行方法
+		void Execute() override {}
+	};
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../../Framework/Port.hpp"
+#include "../../Framework/Processor.hpp"
+#include "../../Framework/Channel.hpp"
+
+#include <utility>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 移动值的处理器
+	 * @tparam ValueType 值类型
+	 * @author Vincent
+	 * @details
+	 *  ~ 该处理器用于将一个通道的值移动进另一个通道，不复制值本身，适用于轮廓列表等较大的值。
+	 *  ~ 源通道中将留下被移动后的值，对于容器通常为空容器，在重新设置之前不应再读取。
+	 *  ~ 通道在工作流初始化时通过端口挂载，执行时不再按名称查询通道。
+	 */
+	template<typename ValueType>
+	class MoveValueAction : public Core::AbstractProcessor
+	{
+	private:
+		/// 源通道端口
+		Port<ValueType> ChannelFrom;
+		/// 目标通道端口
+		Port<ValueType> ChannelTo;
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 目标执行器
+		 * @param host 宿主
+		 * @param from_name 源通道的名称
+		 * @param to_name 目标通道的名称
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		MoveValueAction(ExecutorType** target_executor, WorkflowType* host,
+				  std::string from_name, std::string to_name) :
+		Core::AbstractProcessor((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host)),
+				ChannelFrom(std::move(from_name), this), ChannelTo(std::move(to_name), this)
+		{}
+
+	protected:
+		/// 执行操作
+		void Execute() override
+		{
+			ChannelTo.Set(ChannelFrom.Take());
+		}
+	};
+}
@@ -1,4 +1,5 @@
 #include "NotifyConditionAction.hpp"
+#include "../Runtime.hpp"
 
 namespace Galaxy::BuiltIn
 {
@@ -7,6 +8,12 @@ namespace Galaxy::BuiltIn
 	{
 		std::unique_lock lock(*Mutex);
 		*Flag = !Reverse;
-		(*Condition).notify_all();
+		auto parked_workflows = (*Condition).NotifyAll();
+		lock.unlock();
+
+		if (!parked_workflows.empty())
+		{
+			Runtime::GetInstance()->WorkflowWaitingZone.AwakeBatch(parked_workflows);
+		}
 	}
-}
\ No newline at end of file
+}
@@ -4,7 +4,7 @@
 #include "../../Framework/Port.hpp"
 #include "../MacroKeywords.hpp"
 #include <mutex>
-#include <condition_variable>
+#include "../Executors/WorkflowConditionVariable.hpp"
 
 namespace Galaxy::BuiltIn
 {
@@ -12,13 +12,14 @@ namespace Galaxy::BuiltIn
 	 * @brief 等待条件变量处理器
 	 * @author Vincent
 	 * @details
-	 *  ~ 该流处理器用于唤醒所有等待条件变量的线程。
+	 *  ~ 该流处理器用于唤醒所有等待条件变量的工作流和线程。
 	 *  ~ 需要三个通道，条件变量通道、互斥量通道、旗标通道。
+	 *  ~ 停放的工作流将按照其执行器分组，批量提交。
 	 */
 	class NotifyConditionAction AsProcessor
 	{
 	Requirement:
-		Require(std::condition_variable, Condition);
+		Require(Galaxy::WorkflowConditionVariable, Condition);
 		Require(std::mutex, Mutex);
 		Require(bool, Flag);
 
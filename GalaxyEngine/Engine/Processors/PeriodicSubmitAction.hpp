@@ -0,0 +1,78 @@
+#pragma once
+
+#include <type_traits>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "RateLimitAction.hpp"
+#include "../../Engine/Core/AbstractExecutor.hpp"
+#include "../../Engine/Core/Tools/WorkflowAccess.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 周期提交动作
+	 * @author Vincent
+	 * @details
+	 *  ~ 该动作按照固定的周期将一个内置工作流提交到其第一个执行器上，应当指定在计时执行器上执行。
+	 *  ~ 宿主工作流应当开启循环，每次循环将在计时执行器中停放至下一个周期，期间不占用任何线程。
+	 *  ~ 若到达周期时上一次提交的子工作流尚未执行完毕，则本周期将被跳过，以免重复提交同一工作流。
+	 *  ~ 子工作流的结束事件将被该动作占用。
+	 */
+	template<typename WorkflowClass,
+			typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowClass>>>
+	class PeriodicSubmitAction : public RateLimitAction
+	{
+	public:
+		/// 子工作流
+		WorkflowClass SubWorkflow;
+
+	protected:
+		/// 子工作流是否正在执行
+		std::atomic_bool SubWorkflowRunning {false};
+		/// 因子工作流尚未执行完毕而被跳过的周期数
+		std::atomic<std::uint64_t> SkippedPeriodsCount {0};
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 目标执行器，应当为计时执行器
+		 * @param host 宿主
+		 * @param period 提交周期
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		PeriodicSubmitAction(ExecutorType** target_executor, WorkflowType* host,
+					   std::chrono::steady_clock::duration period) :
+			RateLimitAction(target_executor, host, period)
+		{
+			// 在结束事件中标记子工作流已经执行完毕
+			SubWorkflow.OnEnd = [this]{
+				SubWorkflowRunning = false;
+			};
+		}
+
+		/**
+		 * @brief 获取被跳过的周期数
+		 * @return 因子工作流尚未执行完毕而被跳过的周期数
+		 */
+		[[nodiscard]] std::uint64_t GetSkippedPeriodsCount() const
+		{
+			return SkippedPeriodsCount.load(std::memory_order_relaxed);
+		}
+
+	protected:
+		/// 执行操作
+		void Execute() override
+		{
+			if (SubWorkflowRunning.exchange(true))
+			{
+				SkippedPeriodsCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			Core::Tools::WorkflowAccess::GetCurrentExecutor(&SubWorkflow)->Submit(&SubWorkflow);
+		}
+	};
+}
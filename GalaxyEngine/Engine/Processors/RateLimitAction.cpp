@@ -0,0 +1,24 @@
+#include "RateLimitAction.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/// 计算到期时间
+	std::chrono::steady_clock::time_point RateLimitAction::ScheduleDueTime()
+	{
+		auto now = std::chrono::steady_clock::now();
+
+		// 首次到达或已错过放行时间，则立即放行
+		auto release_time = now;
+		if (NextReleaseTime && *NextReleaseTime > now)
+		{
+			release_time = *NextReleaseTime;
+		}
+		NextReleaseTime = release_time + Period;
+
+		return release_time;
+	}
+
+	/// 执行方法
+	void RateLimitAction::Execute()
+	{}
+}
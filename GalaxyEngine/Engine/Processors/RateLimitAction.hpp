@@ -0,0 +1,51 @@
+#pragma once
+
+#include "TimedAction.hpp"
+
+#include <type_traits>
+#include <chrono>
+#include <optional>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 限速动作
+	 * @author Vincent
+	 * @details
+	 *  ~ 工作流每个周期至多通过该动作一次，提前到达的工作流将在计时执行器中停放至下一个放行时间。
+	 *  ~ 放行时间按照固定的周期排列，而非从上次到达开始计算，故循环工作流可以以稳定的频率运行。
+	 *  ~ 若工作流到达时已经错过放行时间，则立即放行，并从此刻重新开始计算周期，不会补发错过的周期。
+	 */
+	class RateLimitAction : public TimedAction
+	{
+	public:
+		/// 放行周期
+		std::chrono::steady_clock::duration Period;
+
+	protected:
+		/// 下一次放行时间
+		std::optional<std::chrono::steady_clock::time_point> NextReleaseTime {};
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 目标执行器，应当为计时执行器
+		 * @param host 宿主
+		 * @param period 放行周期
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		RateLimitAction(ExecutorType** target_executor, WorkflowType* host, std::chrono::steady_clock::duration period) :
+			TimedAction((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host)),
+			Period(period)
+		{}
+
+		/// 计算到期时间，为下一个放行时间
+		std::chrono::steady_clock::time_point ScheduleDueTime() override;
+
+	protected:
+		/// 执行方法，不进行任何操作
+		void Execute() override;
+	};
+}
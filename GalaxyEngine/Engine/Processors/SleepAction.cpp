@@ -0,0 +1,14 @@
+#include "SleepAction.hpp"
+
+namespace Galaxy::BuiltIn
+{
+	/// 计算到期时间
+	std::chrono::steady_clock::time_point SleepAction::ScheduleDueTime()
+	{
+		return std::chrono::steady_clock::now() + Duration;
+	}
+
+	/// 执行方法
+	void SleepAction::Execute()
+	{}
+}
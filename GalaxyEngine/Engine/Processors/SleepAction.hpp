@@ -0,0 +1,44 @@
+#pragma once
+
+#include "TimedAction.hpp"
+
+#include <type_traits>
+#include <chrono>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 休眠动作
+	 * @author Vincent
+	 * @details
+	 *  ~ 工作流将在计时执行器中停放指定的时长，随后继续执行后续的流处理器。
+	 *  ~ 与在执行器线程中调用sleep_for不同，休眠期间执行器线程可以执行其他工作流。
+	 */
+	class SleepAction : public TimedAction
+	{
+	public:
+		/// 休眠时长
+		std::chrono::steady_clock::duration Duration;
+
+		/**
+		 * @brief 构造函数
+		 * @param target_executor 目标执行器，应当为计时执行器
+		 * @param host 宿主
+		 * @param duration 休眠时长
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		SleepAction(ExecutorType** target_executor, WorkflowType* host, std::chrono::steady_clock::duration duration) :
+			TimedAction((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host)),
+			Duration(duration)
+		{}
+
+		/// 计算到期时间，为当前时间加上休眠时长
+		std::chrono::steady_clock::time_point ScheduleDueTime() override;
+
+	protected:
+		/// 执行方法，不进行任何操作
+		void Execute() override;
+	};
+}
@@ -3,6 +3,7 @@
 #include <type_traits>
 #include <functional>
 #include <utility>
+#include <cstdint>
 #include "../../Framework/Port.hpp"
 #include "../../Framework/Processor.hpp"
 #include "../../Framework/Channel.hpp"
@@ -34,6 +35,12 @@ namespace Galaxy::BuiltIn
 		 */
 		bool Async;
 
+	private:
+		/// 父工作流等待子工作流时的等待代数
+		std::uint64_t WaitingGeneration {0};
+
+	public:
+
 		/**
 		 * @brief 构造函数
 		 * @param target_executor 目标执行器
@@ -50,10 +57,9 @@ namespace Galaxy::BuiltIn
 		{
 			if (!Async)
 			{
-				PauseWorkflowFlag = true;
-				// 在结束事件中唤醒父工作流
-				SubWorkflow.OnEnd = [workflow = this->GetWorkflow()]{
-					Runtime::GetInstance()->WorkflowWaitingZone.Awake(workflow);
+				// 在结束事件中唤醒父工作流，只结束提交子工作流时的那一次等待
+				SubWorkflow.OnEnd = [this]{
+					Runtime::GetInstance()->WorkflowWaitingZone.Awake(this->GetWorkflow(), WaitingGeneration);
 				};
 			}
 		}
@@ -62,6 +68,13 @@ namespace Galaxy::BuiltIn
 		/// 执行操作
 		void Execute() override
 		{
+			// 子工作流可能在进入等待前就已结束，故须在提交子工作流前挂起
+			if (!Async)
+			{
+				SuspendUntilJoined(1);
+				WaitingGeneration = WorkflowWaitingExecutor::GetWaitingGeneration(GetWorkflow());
+			}
+
 			(*GetExecutor())->Submit(&SubWorkflow);
 
 			if (!Async)
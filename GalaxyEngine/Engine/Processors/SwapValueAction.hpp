@@ -4,8 +4,6 @@
 #include "../../Framework/Processor.hpp"
 #include "../../Framework/Channel.hpp"
 
-#include "../../Engine/Core/Tools/WorkflowAccess.hpp"
-
 #include <utility>
 
 namespace Galaxy::BuiltIn
@@ -16,15 +14,17 @@ namespace Galaxy::BuiltIn
 	 * @author Vincent
 	 * @details
 	 *  ~ 该处理器用于交换两个通道的值。
+	 *  ~ 交换只涉及两个通道持有的值的指针，不移动或复制值本身，耗时与值的大小无关；与这两个通道连接的其他通道仍然持有交换前的值。
+	 *  ~ 通道在工作流初始化时通过端口挂载，执行时不再按名称查询通道。
 	 */
 	template<typename ValueType>
 	class SwapValueAction : public Core::AbstractProcessor
 	{
 	private:
-		/// 通道1的名称
-		std::string ChannelName1;
-		/// 通道2的名称
-		std::string ChannelName2;
+		/// 通道1的端口
+		Port<ValueType> Channel1;
+		/// 通道2的端口
+		Port<ValueType> Channel2;
 
 	public:
 		/**
@@ -39,20 +39,14 @@ namespace Galaxy::BuiltIn
 				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
 		SwapValueAction(ExecutorType** target_executor, WorkflowType* host, std::string name1, std::string name2) :
 		Core::AbstractProcessor((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host)),
-			ChannelName1(std::move(name1)), ChannelName2(std::move(name2))
+			Channel1(std::move(name1), this), Channel2(std::move(name2), this)
 		{}
 
 	protected:
 		/// 执行操作
 		void Execute() override
 		{
-			auto* channel1 = static_cast<Channel<ValueType>*>(
-					Core::Tools::WorkflowAccess::GetChannel(GetWorkflow(), ChannelName1));
-			auto* channel2 = static_cast<Channel<ValueType>*>(
-					Core::Tools::WorkflowAccess::GetChannel(GetWorkflow(), ChannelName2));
-			auto channel1_value = channel1->Acquire();
-			channel1->Acquire() = channel2->Acquire();
-			channel2->Acquire() = channel1_value;
+			Channel1.Swap(Channel2);
 		}
 	};
 }
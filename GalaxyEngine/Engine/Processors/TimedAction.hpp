@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Core/AbstractProcessor.hpp"
+
+#include <chrono>
+
+namespace Galaxy::BuiltIn
+{
+	/**
+	 * @brief 定时动作
+	 * @author Vincent
+	 * @details
+	 *  ~ 定时动作应当指定在计时执行器上执行。
+	 *  ~ 工作流被提交到计时执行器时，计时执行器将询问即将执行的定时动作的到期时间，
+	 *    并将工作流停放在时间轮中，到期后再执行该动作，期间不占用任何线程。
+	 */
+	class TimedAction : public Core::AbstractProcessor
+	{
+	public:
+		using Core::AbstractProcessor::AbstractProcessor;
+
+		/**
+		 * @brief 计算到期时间
+		 * @return 该动作应当被执行的时间
+		 * @details
+		 *  ~ 工作流每次被提交到计时执行器时调用一次，调用线程为提交者所在的线程。
+		 */
+		virtual std::chrono::steady_clock::time_point ScheduleDueTime() = 0;
+	};
+}
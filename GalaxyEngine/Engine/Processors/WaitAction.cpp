@@ -7,6 +7,8 @@ namespace Galaxy::BuiltIn
 	/// 执行方法
 	void WaitAction::Execute()
 	{
+		// 先挂起再进入等待，唤醒者将与挂起的工作流汇合
+		SuspendUntilJoined(1);
 		Runtime::GetInstance()->WorkflowWaitingZone.Submit(GetWorkflow());
 	}
 }
@@ -15,6 +15,9 @@ namespace Galaxy::BuiltIn
 	 * @author Vincent
 	 * @details
 	 *  ~ 该动作会将自身传入工作流等待区，等待唤醒。
+	 *  ~ 等待期间工作流被挂起，不占用执行器；被唤醒后将从下一个流处理器继续执行。
+	 *  ~ 进入等待前工作流的代数即为本次等待的代数，唤醒者应当通过WorkflowWaitingExecutor::GetWaitingGeneration记下它，
+	 *    并以该代数调用Awake，以免重复或迟到的唤醒结束工作流之后的等待。
 	 */
 	class WaitAction : public Core::AbstractProcessor
 	{
@@ -29,9 +32,7 @@ namespace Galaxy::BuiltIn
 				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
 		WaitAction(ExecutorType** target_executor, WorkflowType* host) :
 				Core::AbstractProcessor((Core::AbstractExecutor**)(target_executor), (Core::AbstractWorkflow*)(host))
-		{
-			PauseWorkflowFlag = true;
-		}
+		{}
 
 	protected:
 		/// 执行操作
@@ -1,4 +1,6 @@
 #include "WaitConditionAction.hpp"
+#include "../Core/Tools/WorkflowAccess.hpp"
+#include "../Runtime.hpp"
 
 namespace Galaxy::BuiltIn
 {
@@ -6,9 +8,25 @@ namespace Galaxy::BuiltIn
 	void WaitConditionAction::Execute()
 	{
 		std::unique_lock lock((*Mutex));
-		(*Condition).wait(lock, [flag = &this->Flag, reverse = this->Reverse]{
-			return flag->Acquire() != reverse;});
-		(*Flag) = Reverse;
+
+		// 无法停放的工作流只能阻塞等待
+		if (!Core::Tools::WorkflowAccess::IsSuspendable(GetWorkflow()))
+		{
+			(*Condition).Wait(lock, [flag = &this->Flag, reverse = this->Reverse]{
+				return flag->Acquire() != reverse;});
+		}
+
+		if ((*Flag) != Reverse)
+		{
+			(*Flag) = Reverse;
+			return;
+		}
+
+		// 条件不成立，停放工作流，被通知后重新执行本流处理器
+		SuspendUntilJoined(1, true);
+		(*Condition).Enlist(GetWorkflow(), WorkflowWaitingExecutor::GetWaitingGeneration(GetWorkflow()));
 		lock.unlock();
+
+		Runtime::GetInstance()->WorkflowWaitingZone.Submit(GetWorkflow());
 	}
-}
\ No newline at end of file
+}
@@ -4,7 +4,7 @@
 #include "../../Framework/Port.hpp"
 #include "../MacroKeywords.hpp"
 #include <mutex>
-#include <condition_variable>
+#include "../Executors/WorkflowConditionVariable.hpp"
 
 namespace Galaxy::BuiltIn
 {
@@ -14,11 +14,14 @@ namespace Galaxy::BuiltIn
 	 * @details
 	 *  ~ 该流处理器用于等待条件变量。
 	 *  ~ 需要三个通道，条件变量通道、互斥量通道、旗标通道。
+	 *  ~ 条件不成立时，工作流将被停放在工作流等待区，执行器可以继续执行其他工作流；
+	 *    被通知后将重新执行该流处理器，再次检查条件，故多个等待者中只有一个能够消耗同一次通知。
+	 *  ~ 依赖图模式和流水线模式下无法停放工作流，将在执行器线程中阻塞等待。
 	 */
 	class WaitConditionAction AsProcessor
 	{
 	Requirement:
-		Require(std::condition_variable, Condition);
+		Require(Galaxy::WorkflowConditionVariable, Condition);
 		Require(std::mutex, Mutex);
 		Require(bool, Flag);
 
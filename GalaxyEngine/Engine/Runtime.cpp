@@ -39,4 +39,33 @@ namespace Galaxy
 			ManagedExecutors.erase(executor);
 		}
 	}
+
+	/// 注册执行器
+	void Runtime::RegisterExecutors(const std::vector<Core::AbstractExecutor *> &executors)
+	{
+		std::unique_lock lock(ManagedExecutorsMutex);
+		for (auto* executor : executors)
+		{
+			ManagedExecutors.insert(executor);
+		}
+	}
+
+	/// 获取处理器拓扑
+	const CPUTopology &Runtime::GetTopology()
+	{
+		std::unique_lock lock(TopologyMutex);
+		if (!Topology)
+		{
+			Topology = CPUTopology::Detect();
+		}
+		return *Topology;
+	}
+
+	/// 加载处理器拓扑
+	void Runtime::LoadTopology(const std::string &path)
+	{
+		auto topology = CPUTopology::Load(path);
+		std::unique_lock lock(TopologyMutex);
+		Topology = std::move(topology);
+	}
 }
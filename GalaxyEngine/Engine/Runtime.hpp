@@ -2,6 +2,11 @@
 
 #include <unordered_set>
 #include <shared_mutex>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <string>
+#include "CPUTopology.hpp"
 #include "Executors/RealtimeExecutor.hpp"
 #include "Executors/WorkflowWaitingExecutor.hpp"
 #include "Executors/WorkflowDeleterExecutor.hpp"
@@ -39,6 +44,11 @@ namespace Galaxy
 		/// 托管执行器集合互斥量
 		std::shared_mutex ManagedExecutorsMutex;
 
+		/// 处理器拓扑，首次获取时读取
+		std::optional<CPUTopology> Topology;
+		/// 处理器拓扑互斥量
+		std::mutex TopologyMutex;
+
 	public:
 
 		/**
@@ -85,5 +95,28 @@ namespace Galaxy
 		 *  ~ 注销完成后，StopAllExecutors方法将不再可以影响到该执行器。
 		 */
 		void UnregisterExecutors(std::initializer_list<Core::AbstractExecutor*> executors);
+
+		/**
+		 * @brief 注册允许接受通知的执行器
+		 * @param executors 执行器列表
+		 */
+		void RegisterExecutors(const std::vector<Core::AbstractExecutor*>& executors);
+
+		/**
+		 * @brief 获取处理器拓扑
+		 * @return 处理器拓扑
+		 * @details
+		 *  ~ 若尚未加载拓扑文件，则首次调用时将从/sys/devices/system/cpu中读取。
+		 */
+		const CPUTopology& GetTopology();
+
+		/**
+		 * @brief 从用户提供的拓扑文件中加载处理器拓扑
+		 * @param path 拓扑文件路径
+		 * @throw std::runtime_error 当文件不存在或格式错误
+		 * @details
+		 *  ~ 加载的拓扑将取代从系统中读取的拓扑，应当在构建执行器前调用。
+		 */
+		void LoadTopology(const std::string& path);
 	};
 }
\ No newline at end of file
@@ -106,6 +106,18 @@ namespace Galaxy
 			ValuePointer = upstream_channel.ValuePointer;
 		}
 
+		/**
+		 * @brief 与另一个通道交换值
+		 * @param other 另一个通道
+		 * @details
+		 *  ~ 只交换两个通道持有的值的指针，不移动或复制值本身，耗时与值的大小无关。
+		 *  ~ 与这两个通道连接的其他通道仍然持有交换前的值。
+		 */
+		void Swap(Channel<ValueType>& other) noexcept
+		{
+			ValuePointer.swap(other.ValuePointer);
+		}
+
 		//==============================
 		// 其他操作符部分
 		//==============================
@@ -137,7 +149,7 @@ namespace Galaxy
 		{
 			if (&target != this)
 			{
-				Acquire() = target.ValuePointer;
+				Acquire() = *target.ValuePointer;
 			}
 			return *this;
 		}
@@ -154,7 +166,7 @@ namespace Galaxy
 		template<typename = typename std::enable_if<std::is_move_assignable_v<ValueType>>>
 		Channel<ValueType>& operator=(Channel<ValueType>&& target) noexcept
 		{
-			Acquire() = std::move(target.ValuePointer);
+			Acquire() = std::move(*target.ValuePointer);
 			return *this;
 		}
 
@@ -166,7 +178,7 @@ namespace Galaxy
 		template<typename = typename std::enable_if<std::is_move_assignable_v<ValueType>>>
 		Channel<ValueType>& operator<<(Channel<ValueType>&& target) noexcept
 		{
-			Acquire() = std::move(target.ValuePointer);
+			Acquire() = std::move(*target.ValuePointer);
 			return *this;
 		}
 
@@ -176,7 +188,7 @@ namespace Galaxy
 		{
 			if (&target != this)
 			{
-				Acquire() = target.ValuePointer;
+				Acquire() = *target.ValuePointer;
 			}
 			return *this;
 		}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory_resource>
+#include <type_traits>
+#include "Channel.hpp"
+#include "../Engine/Core/AbstractWorkflow.hpp"
+
+namespace Galaxy
+{
+	/**
+	 * @brief 帧通道模板类
+	 * @tparam ValueType 值类型，须为可以由std::pmr::memory_resource指针构造的容器，例如std::pmr::vector
+	 * @author Vincent
+	 * @details
+	 *  ~ 通道中的容器使用宿主工作流的帧内存区分配内存，每次迭代开始时容器将被重新构造为空容器，其内存随内存区一并回收。
+	 *  ~ 嵌套的std::pmr容器会将内存资源传递给其元素，故整个容器的内存都来自同一块连续内存，且由执行该工作流的CPU分配和回收。
+	 *  ~ 容器在每次迭代开始时都是空的，流处理器不需要再手动清空；也不应将容器移动到迭代结束后仍需要使用的位置。
+	 *  ~ 通道连接后，下游通道将使用上游通道的容器，但只有上游通道会在其工作流的迭代开始时重置容器。
+	 */
+	template<typename ValueType>
+	class FrameChannel : public Channel<ValueType>
+	{
+		static_assert(std::is_constructible_v<ValueType, std::pmr::memory_resource*>,
+			"Value Type of Frame Channel Must be Constructible from a Memory Resource.");
+
+	public:
+		/// 多名称构造函数
+		template<typename WorkflowType, typename... ArgumentsType>
+		explicit FrameChannel(WorkflowType* host, ArgumentsType... arguments) :
+			Channel<ValueType>(host, arguments...)
+		{
+			auto& arena = ((Core::AbstractWorkflow*)(host))->Arena;
+			// 默认构造的值使用默认资源，须替换为使用内存区的值，此时尚未与其他通道连接
+			this->ValuePointer = std::make_shared<ValueType>(arena.GetResource());
+			// 持有本通道自己的值，使得连接到其他通道后，重置也不会影响上游通道的值
+			arena.Subscribe([value = this->ValuePointer, resource = arena.GetResource()]{
+				*value = ValueType(resource);
+			});
+		}
+	};
+}
@@ -61,6 +61,29 @@ namespace Galaxy
 			return Acquire();
 		}
 
+		/**
+		 * @brief 取走值
+		 * @return 从通道中移动出的值
+		 * @details
+		 *  ~ 值将被移动而非复制，通道中将留下被移动后的值，对于容器通常为空容器；在重新设置之前不应再读取该通道。
+		 */
+		ValueType Take()
+		{
+			return std::move(Acquire());
+		}
+
+		/**
+		 * @brief 与另一个端口挂载的通道交换值
+		 * @param other 另一个端口
+		 * @details
+		 *  ~ 只交换两个通道持有的值的指针，不移动或复制值本身，详见Channel::Swap。
+		 */
+		void Swap(Port<ValueType>& other) noexcept
+		{
+			static_cast<Channel<ValueType>*>(this->GetMountedChannel())->Swap(
+				*static_cast<Channel<ValueType>*>(other.GetMountedChannel()));
+		}
+
 		//==============================
 		// 操作符重载部分
 		//==============================
@@ -107,7 +130,7 @@ namespace Galaxy
 		template<typename = typename std::enable_if<std::is_move_assignable_v<ValueType>>>
 		Port<ValueType>& operator=(ValueType&& value)
 		{
-			Set(value);
+			Set(std::move(value));
 			return *this;
 		}
 
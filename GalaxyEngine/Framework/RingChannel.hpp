@@ -0,0 +1,261 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include "Channel.hpp"
+#include "../Engine/Awaitables/ConditionAwaitable.hpp"
+
+namespace Galaxy
+{
+	/**
+	 * @brief 单生产者单消费者环形缓冲
+	 * @tparam ValueType 值类型
+	 * @tparam Capacity 容量，须为2的幂
+	 * @author Vincent
+	 * @details
+	 *  ~ 槽位在构造时全部分配，推入和取出只移动值，不分配内存，也不使用锁。
+	 *  ~ 每个槽位带有序号，生产者和消费者只通过槽位序号同步，不需要读取对方的下标；
+	 *    非覆盖推入和取出都只需常数步即可完成，是无等待的。
+	 *  ~ 同一时刻只允许一个生产者和一个消费者，二者可以位于不同的工作流和执行器上。
+	 *  ~ 三种使用方式：
+	 *    轮询：调用TryPush或TryPop，失败时直接返回；
+	 *    阻塞：在流处理器中等待Writable或Readable后再推入或取出，等待期间工作流离开执行器，不占用线程；
+	 *    覆盖：调用PushOverwrite，缓冲已满时丢弃最旧的值，生产者永远不会等待消费者，适用于相机帧等只关心最新值的数据。
+	 */
+	template<typename ValueType, std::size_t Capacity>
+	class RingBuffer
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity of Ring Buffer Must be a Power of 2.");
+
+	private:
+		/// 下标掩码
+		static constexpr std::size_t IndexMask = Capacity - 1;
+
+		/**
+		 * @brief 槽位
+		 * @details
+		 *  ~ 序号等于下标时，槽位空闲，可以写入该下标的值；序号等于下标加一时，槽位存有该下标的值，可以被取出。
+		 *  ~ 每个槽位独占缓存行，生产者和消费者访问相邻槽位时不会互相干扰。
+		 */
+		struct alignas(64) Slot
+		{
+			/// 序号
+			std::atomic<std::uint64_t> Sequence {0};
+			/// 值
+			ValueType Value {};
+		};
+
+		/// 槽位数组
+		std::array<Slot, Capacity> Slots;
+
+		/// 下一个需要取出的下标，只在覆盖推入时由生产者修改
+		alignas(64) std::atomic<std::uint64_t> Head {0};
+		/// 下一个需要写入的下标，只由生产者修改
+		alignas(64) std::atomic<std::uint64_t> Tail {0};
+		/// 因覆盖而丢弃的值的数量
+		std::atomic_size_t DroppedCount {0};
+
+		/**
+		 * @brief 写入槽位并发布
+		 * @param slot 槽位
+		 * @param tail 写入的下标
+		 * @param value 值
+		 */
+		template<typename ArgumentType>
+		void Publish(Slot& slot, std::uint64_t tail, ArgumentType&& value)
+		{
+			slot.Value = std::forward<ArgumentType>(value);
+			slot.Sequence.store(tail + 1, std::memory_order_release);
+			Tail.store(tail + 1);
+			Readable.Notify();
+		}
+
+	public:
+		/**
+		 * @brief 可读事件
+		 * @details
+		 *  ~ 缓冲非空时就绪，由消费者的流处理器等待，生产者推入后将唤醒之。
+		 */
+		BuiltIn::ConditionAwaitable Readable {[this]{ return !IsEmpty(); }};
+
+		/**
+		 * @brief 可写事件
+		 * @details
+		 *  ~ 缓冲未满时就绪，由生产者的流处理器等待，消费者取出后将唤醒之。
+		 */
+		BuiltIn::ConditionAwaitable Writable {[this]{ return !IsFull(); }};
+
+		/// 构造函数
+		RingBuffer()
+		{
+			for (std::size_t index = 0; index < Capacity; ++index)
+			{
+				Slots[index].Sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		RingBuffer(const RingBuffer&) = delete;
+		RingBuffer& operator=(const RingBuffer&) = delete;
+
+		/**
+		 * @brief 尝试推入
+		 * @param value 值
+		 * @retval true 推入成功
+		 * @retval false 缓冲已满，值未被推入
+		 * @details
+		 *  ~ 只应由生产者调用。
+		 */
+		template<typename ArgumentType>
+		bool TryPush(ArgumentType&& value)
+		{
+			auto tail = Tail.load(std::memory_order_relaxed);
+			auto& slot = Slots[tail & IndexMask];
+			if (slot.Sequence.load(std::memory_order_acquire) != tail)
+			{
+				return false;
+			}
+			Publish(slot, tail, std::forward<ArgumentType>(value));
+			return true;
+		}
+
+		/**
+		 * @brief 推入，缓冲已满时覆盖最旧的值
+		 * @param value 值
+		 * @retval true 最旧的值被丢弃
+		 * @retval false 没有值被丢弃
+		 * @details
+		 *  ~ 只应由生产者调用。
+		 *  ~ 生产者通过原子比较交换从消费者手中取回最旧的槽位；仅当消费者恰好正在取出该值时，需要等待其移动完毕。
+		 */
+		template<typename ArgumentType>
+		bool PushOverwrite(ArgumentType&& value)
+		{
+			auto tail = Tail.load(std::memory_order_relaxed);
+			auto& slot = Slots[tail & IndexMask];
+
+			bool dropped = false;
+			while (slot.Sequence.load(std::memory_order_acquire) != tail)
+			{
+				// 缓冲已满，该槽位存有最旧的值
+				std::uint64_t oldest = tail - Capacity;
+				if (Head.compare_exchange_strong(oldest, oldest + 1))
+				{
+					dropped = true;
+					break;
+				}
+				// 消费者已经认领最旧的值，槽位将在其移动完毕后空闲
+				std::this_thread::yield();
+			}
+
+			Publish(slot, tail, std::forward<ArgumentType>(value));
+			if (dropped)
+			{
+				DroppedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			return dropped;
+		}
+
+		/**
+		 * @brief 尝试取出
+		 * @param value 用于存放取出的值
+		 * @retval true 取出成功
+		 * @retval false 缓冲为空
+		 * @details
+		 *  ~ 只应由消费者调用；值将被移动到参数中。
+		 */
+		bool TryPop(ValueType& value)
+		{
+			auto head = Head.load(std::memory_order_relaxed);
+			while (true)
+			{
+				auto& slot = Slots[head & IndexMask];
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<std::int64_t>(sequence - (head + 1));
+				if (difference < 0)
+				{
+					return false;
+				}
+				if (difference > 0)
+				{
+					// 生产者覆盖了最旧的值并推进了读取下标
+					head = Head.load(std::memory_order_relaxed);
+					continue;
+				}
+				// 认领失败时说明生产者刚刚覆盖了该值，比较交换会更新读取下标
+				if (Head.compare_exchange_weak(head, head + 1))
+				{
+					value = std::move(slot.Value);
+					slot.Sequence.store(head + Capacity, std::memory_order_release);
+					Writable.Notify();
+					return true;
+				}
+			}
+		}
+
+		/**
+		 * @brief 查询是否为空
+		 * @return 调用时刻缓冲是否为空
+		 */
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return Tail.load() == Head.load();
+		}
+
+		/**
+		 * @brief 查询是否已满
+		 * @return 调用时刻缓冲是否已满
+		 */
+		[[nodiscard]] bool IsFull() const
+		{
+			return Tail.load() - Head.load() >= Capacity;
+		}
+
+		/**
+		 * @brief 获取值的数量
+		 * @return 调用时刻缓冲中值的数量
+		 */
+		[[nodiscard]] std::size_t GetSize() const
+		{
+			return static_cast<std::size_t>(Tail.load() - Head.load());
+		}
+
+		/**
+		 * @brief 获取因覆盖而丢弃的值的数量
+		 * @return 自构造以来被覆盖推入丢弃的值的数量
+		 */
+		[[nodiscard]] std::size_t GetDroppedCount() const
+		{
+			return DroppedCount.load(std::memory_order_relaxed);
+		}
+
+		/// 获取容量
+		static constexpr std::size_t GetCapacity()
+		{
+			return Capacity;
+		}
+	};
+
+	/**
+	 * @brief 环形通道模板类
+	 * @tparam ValueType 值类型
+	 * @tparam Capacity 容量，须为2的幂
+	 * @author Vincent
+	 * @details
+	 *  ~ 通道的值为单生产者单消费者环形缓冲，用于连接两个独立调度的工作流：
+	 *    生产者工作流与消费者工作流各自声明同名的环形通道，并使消费者的通道连接到生产者的通道，二者即共享同一个缓冲。
+	 *  ~ 流处理器通过RingBuffer<ValueType, Capacity>类型的端口访问缓冲；模板参数中的逗号会被端口声明关键字拆分，故应当先声明类型别名。
+	 */
+	template<typename ValueType, std::size_t Capacity>
+	class RingChannel : public Channel<RingBuffer<ValueType, Capacity>>
+	{
+	public:
+		/// 缓冲类型
+		using BufferType = RingBuffer<ValueType, Capacity>;
+
+		using Channel<RingBuffer<ValueType, Capacity>>::Channel;
+	};
+}
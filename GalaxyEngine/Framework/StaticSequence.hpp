@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "Port.hpp"
+#include "Processor.hpp"
+
+namespace Galaxy::Static
+{
+	/**
+	 * @brief 通道列表
+	 * @tparam ChannelTags 通道标签类型，每个标签须提供值类型ValueType和名称Name
+	 * @details
+	 *  ~ 通道标签通常使用StaticChannel关键字声明；只在序列内部传递的通道使用StaticInternalChannel关键字声明，
+	 *    其标签还提供值为true的IsInternal。
+	 */
+	template<typename... ChannelTags>
+	struct ChannelSet {};
+
+	/**
+	 * @brief 只读绑定
+	 * @tparam ChannelTag 通道标签类型
+	 * @details
+	 *  ~ 使用该绑定时，步骤将以常值引用接收通道的值。
+	 */
+	template<typename ChannelTag>
+	struct ReadOnly {};
+
+	/**
+	 * @brief 静态步骤
+	 * @tparam StepProcessorType 步骤类型，须可默认构造，并提供以绑定通道的值为参数的Execute方法
+	 * @tparam Bindings 按照Execute参数顺序排列的通道标签或只读绑定
+	 */
+	template<typename StepProcessorType, typename... Bindings>
+	struct Step
+	{
+		using ProcessorType = StepProcessorType;
+	};
+
+	namespace Detail
+	{
+		/// 绑定特征
+		template<typename Binding>
+		struct BindingTraits
+		{
+			using Tag = Binding;
+			using ArgumentType = typename Binding::ValueType&;
+			static constexpr bool IsReadOnly = false;
+		};
+
+		/// 只读绑定特征
+		template<typename ChannelTag>
+		struct BindingTraits<ReadOnly<ChannelTag>>
+		{
+			using Tag = ChannelTag;
+			using ArgumentType = const typename ChannelTag::ValueType&;
+			static constexpr bool IsReadOnly = true;
+		};
+
+		/// 查询类型在类型列表中的下标，不存在时返回列表长度
+		template<typename Target, typename... Candidates>
+		constexpr std::size_t IndexOf()
+		{
+			constexpr bool matches[] = {std::is_same_v<Target, Candidates>..., false};
+			for (std::size_t index = 0; index < sizeof...(Candidates); ++index)
+			{
+				if (matches[index]) return index;
+			}
+			return sizeof...(Candidates);
+		}
+
+		/// 查询类型列表中是否有重复的类型
+		template<typename... Candidates>
+		constexpr bool HasDuplicates()
+		{
+			constexpr std::size_t indices[] = {IndexOf<Candidates, Candidates...>()..., 0};
+			for (std::size_t index = 0; index < sizeof...(Candidates); ++index)
+			{
+				if (indices[index] != index) return true;
+			}
+			return false;
+		}
+
+		/// 检查步骤类型能否以指定参数执行
+		template<typename Void, typename StepProcessorType, typename... ArgumentsType>
+		struct IsExecutable : std::false_type {};
+
+		template<typename StepProcessorType, typename... ArgumentsType>
+		struct IsExecutable<std::void_t<decltype(std::declval<StepProcessorType&>().Execute(
+				std::declval<ArgumentsType>()...))>, StepProcessorType, ArgumentsType...> : std::true_type {};
+
+		/// 查询通道标签是否为内部通道
+		template<typename ChannelTag, typename = void>
+		struct IsInternal : std::false_type {};
+
+		template<typename ChannelTag>
+		struct IsInternal<ChannelTag, std::void_t<decltype(ChannelTag::IsInternal)>> :
+			std::bool_constant<ChannelTag::IsInternal> {};
+
+		/// 查询步骤是否可能写入通道
+		template<typename ChannelTag, typename StepType>
+		struct StepWrites;
+
+		template<typename ChannelTag, typename StepProcessorType, typename... Bindings>
+		struct StepWrites<ChannelTag, Step<StepProcessorType, Bindings...>>
+		{
+			static constexpr bool Value = (std::is_same_v<ChannelTag, Bindings> || ...);
+		};
+
+		/**
+		 * @brief 通道绑定
+		 * @details
+		 *  ~ 持有与通道标签同名的端口；工作流中缺少同名的通道时，工作流将在初始化时抛出异常。
+		 */
+		template<typename ChannelTag, bool IsReadOnly, bool IsInternalChannel = IsInternal<ChannelTag>::value>
+		struct ChannelBinding
+		{
+			/// 端口
+			Port<typename ChannelTag::ValueType> Endpoint;
+
+			/// 构造函数
+			explicit ChannelBinding(Core::AbstractProcessor* host) :
+				Endpoint(ChannelTag::Name, host, false, IsReadOnly)
+			{}
+		};
+
+		/// 内部通道的绑定，不持有端口
+		template<typename ChannelTag, bool IsReadOnly>
+		struct ChannelBinding<ChannelTag, IsReadOnly, true>
+		{
+			/// 构造函数
+			explicit ChannelBinding(Core::AbstractProcessor*)
+			{}
+		};
+	}
+
+	template<typename ChannelList, typename... Steps>
+	class Sequence;
+
+	/**
+	 * @brief 静态序列
+	 * @tparam ChannelTags 序列使用的通道标签
+	 * @tparam Steps 按照执行顺序排列的静态步骤
+	 * @author Vincent
+	 * @details
+	 *  ~ 静态序列在编译期确定步骤顺序和通道绑定，作为一个流处理器在其执行器上依次执行所有步骤，
+	 *    步骤之间没有虚函数调用、通道查询和执行器调度。
+	 *  ~ 绑定了未声明的通道标签，或步骤的Execute方法无法以绑定通道的值调用时，将无法通过编译。
+	 *  ~ 每个通道标签对应一个同名的端口，可以像普通流处理器一样与工作流中的通道交换数据，工作流中必须声明同名的通道；
+	 *    内部通道标签没有端口，其值由序列持有，只在步骤之间传递。只被只读绑定的通道对应的端口为只读端口。
+	 *  ~ 适用于顺序固定且位于同一执行器上的一段流处理器。
+	 */
+	template<typename... ChannelTags, typename... Steps>
+	class Sequence<ChannelSet<ChannelTags...>, Steps...> : public Processor
+	{
+		static_assert(!Detail::HasDuplicates<ChannelTags...>(),
+					  "[Galaxy::Static::Sequence] A Channel Tag is Declared More Than Once.");
+
+	private:
+		/// 通道标签是否被任一步骤以可写的方式绑定
+		template<typename ChannelTag>
+		static constexpr bool IsWritten = (Detail::StepWrites<ChannelTag, Steps>::Value || ...);
+
+		/// 通道绑定
+		std::tuple<Detail::ChannelBinding<ChannelTags, !IsWritten<ChannelTags>>...> Bindings;
+		/// 内部通道的值，非内部通道在此处不占用空间
+		std::tuple<std::conditional_t<Detail::IsInternal<ChannelTags>::value,
+			typename ChannelTags::ValueType, std::monostate>...> Values;
+		/// 本次执行中各通道的值的指针
+		std::tuple<typename ChannelTags::ValueType*...> Resolved;
+		/// 步骤
+		std::tuple<typename Steps::ProcessorType...> StepProcessors;
+
+		/// 为每个通道绑定提供宿主指针
+		template<typename ChannelTag>
+		Core::AbstractProcessor* HostFor()
+		{
+			return this;
+		}
+
+		/// 确定各通道的值的位置
+		template<std::size_t... Indices>
+		void ResolveChannels(std::index_sequence<Indices...>)
+		{
+			((std::get<Indices>(Resolved) = &Acquire<ChannelTags>()), ...);
+		}
+
+		/// 获取绑定对应的参数
+		template<typename Binding>
+		decltype(auto) Bind()
+		{
+			using Traits = Detail::BindingTraits<Binding>;
+			constexpr auto index = Detail::IndexOf<typename Traits::Tag, ChannelTags...>();
+			static_assert(index < sizeof...(ChannelTags),
+						  "[Galaxy::Static::Sequence] A Step Binds a Channel Not Declared in the Channel List.");
+
+			auto& value = *std::get<index>(Resolved);
+			if constexpr (Traits::IsReadOnly)
+			{
+				return std::as_const(value);
+			}
+			else
+			{
+				return (value);
+			}
+		}
+
+		/// 执行一个步骤
+		template<std::size_t StepIndex, typename StepProcessorType, typename... StepBindings>
+		void ExecuteStep(Step<StepProcessorType, StepBindings...>*)
+		{
+			static_assert(Detail::IsExecutable<void, StepProcessorType,
+					typename Detail::BindingTraits<StepBindings>::ArgumentType...>::value,
+					"[Galaxy::Static::Sequence] A Step Can Not Be Executed with Its Bound Channels.");
+
+			std::get<StepIndex>(StepProcessors).Execute(Bind<StepBindings>()...);
+		}
+
+		/// 依次执行所有步骤
+		template<std::size_t... StepIndices>
+		void ExecuteSteps(std::index_sequence<StepIndices...>)
+		{
+			(ExecuteStep<StepIndices>(static_cast<Steps*>(nullptr)), ...);
+		}
+
+	public:
+		/**
+		 * @brief 构造函数
+		 * @tparam ExecutorType 执行器类型
+		 * @tparam WorkflowType 工作流类型
+		 * @param executor 指向执行器指针的指针
+		 * @param workflow 工作流指针
+		 */
+		template<typename ExecutorType, typename WorkflowType,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractExecutor, ExecutorType>>,
+				typename = typename std::enable_if<std::is_base_of_v<Core::AbstractWorkflow, WorkflowType>>>
+		Sequence(ExecutorType** executor, WorkflowType* workflow) :
+			Processor(executor, workflow), Bindings(HostFor<ChannelTags>()...)
+		{}
+
+		/**
+		 * @brief 获取步骤
+		 * @tparam StepIndex 步骤下标
+		 * @return 步骤的引用，可用于在工作流执行前配置步骤
+		 */
+		template<std::size_t StepIndex>
+		auto& GetStep()
+		{
+			return std::get<StepIndex>(StepProcessors);
+		}
+
+		/**
+		 * @brief 获取通道的值
+		 * @tparam ChannelTag 通道标签类型
+		 * @return 内部通道为序列持有的值，否则为工作流中通道的值
+		 * @details
+		 *  ~ 非内部通道的端口在工作流初始化时才会挂载，此前不应访问其值。
+		 */
+		template<typename ChannelTag>
+		typename ChannelTag::ValueType& Acquire()
+		{
+			constexpr auto index = Detail::IndexOf<ChannelTag, ChannelTags...>();
+			static_assert(index < sizeof...(ChannelTags),
+						  "[Galaxy::Static::Sequence] The Channel is Not Declared in the Channel List.");
+
+			if constexpr (Detail::IsInternal<ChannelTag>::value)
+			{
+				return std::get<index>(Values);
+			}
+			else
+			{
+				return std::get<index>(Bindings).Endpoint.Acquire();
+			}
+		}
+
+		/// 执行方法，将依次执行所有步骤
+		void Execute() override
+		{
+			// 端口可能被帧流水线重新挂载，故每次执行前重新确定通道的值的位置
+			ResolveChannels(std::index_sequence_for<ChannelTags...>{});
+			ExecuteSteps(std::index_sequence_for<Steps...>{});
+		}
+	};
+}
@@ -7,29 +7,49 @@
 #include "Engine/Core/AbstractWorkflow.hpp"
 
 #include "Framework/Channel.hpp"
+#include "Framework/FrameChannel.hpp"
+#include "Framework/RingChannel.hpp"
 #include "Framework/Port.hpp"
 #include "Framework/Processor.hpp"
 #include "Framework/Workflow.hpp"
+#include "Framework/StaticSequence.hpp"
 
 #include "Engine/Executors/SerialExecutor.hpp"
 #include "Engine/Executors/ParallelExecutor.hpp"
+#include "Engine/Executors/DeadlineExecutor.hpp"
+#include "Engine/Executors/TimerExecutor.hpp"
+#include "Engine/Executors/WorkflowConditionVariable.hpp"
 
 #include "Engine/Processors/EmptyProcessor.hpp"
 #include "Engine/Processors/InitializeAction.hpp"
 #include "Engine/Processors/LambdaAction.hpp"
 #include "Engine/Processors/SwapValueAction.hpp"
 #include "Engine/Processors/PassValueAction.hpp"
+#include "Engine/Processors/MoveValueAction.hpp"
 #include "Engine/Processors/SubmitWorkflowAction.hpp"
+#include "Engine/Processors/FanOutSubmitAction.hpp"
 #include "Engine/Processors/WaitAction.hpp"
 #include "Engine/Processors/AwakeAction.hpp"
 #include "Engine/Processors/WaitConditionAction.hpp"
 #include "Engine/Processors/NotifyConditionAction.hpp"
+#include "Engine/Processors/TimedAction.hpp"
+#include "Engine/Processors/SleepAction.hpp"
+#include "Engine/Processors/RateLimitAction.hpp"
+#include "Engine/Processors/PeriodicSubmitAction.hpp"
+#include "Engine/Processors/Label.hpp"
+#include "Engine/Processors/BranchAction.hpp"
+
+#include "Engine/Awaitables/ConditionAwaitable.hpp"
+#include "Engine/Awaitables/TimerAwaitable.hpp"
+#include "Engine/Awaitables/DescriptorAwaitable.hpp"
 
 #include "Engine/Decorators/DecoratorIf.hpp"
 
 #include "Engine/MacroKeywords.hpp"
 
 #include "Engine/Runtime.hpp"
+#include "Engine/CPUTopology.hpp"
+#include "Engine/ExecutorSet.hpp"
 
 namespace Galaxy
 {
@@ -0,0 +1,92 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <atomic>
+#include "TestTools.hpp"
+
+/// 条件可等待对象挂起与恢复的行为测试
+
+using namespace Galaxy;
+using Galaxy::Tests::Check;
+using Galaxy::Tests::WaitFor;
+
+/// 条件是否成立
+std::atomic_bool Signaled {false};
+/// 被所有工作流共同等待的条件
+BuiltIn::ConditionAwaitable SharedCondition {[]{ return Signaled.load(); }};
+
+/// 等待共享条件的流处理器
+class AwaitingProcessor AsProcessor
+{
+Requirement:
+	Require(int, Stage);
+
+	Process
+	{
+		AwaitBegin;
+		*Stage = 1;
+		Await(SharedCondition);
+		*Stage = 2;
+		AwaitEnd;
+	}
+};
+
+/// 等待共享条件的工作流
+class AwaitingFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Stage Provide(0, "Stage");
+
+Procedure:
+	AwaitingProcessor Awaiting On(Main);
+};
+
+/// 多个等待者都能被同一次通知恢复，等待期间不占用执行器
+void TestResumeAllWaiters()
+{
+	Signaled = false;
+	SerialExecutor executor;
+	AwaitingFlow first, second;
+	for (auto* workflow : {&first, &second})
+	{
+		workflow->Main = &executor;
+	}
+	executor.Start();
+	executor.Submit(&first);
+	executor.Submit(&second);
+
+	bool suspended = WaitFor([&]{ return *first.Stage == 1 && *second.Stage == 1; });
+	Check(suspended, "Condition: both workflows reach the await on a single serial executor.");
+
+	Signaled = true;
+	SharedCondition.Notify();
+	bool resumed = WaitFor([&]{ return *first.Stage == 2 && *second.Stage == 2; });
+	Check(resumed, "Condition: one notification resumes every waiter.");
+
+	executor.Stop();
+	executor.Join();
+}
+
+/// 条件已经成立时不会挂起
+void TestReadyCondition()
+{
+	Signaled = true;
+	SerialExecutor executor;
+	AwaitingFlow workflow;
+	workflow.Main = &executor;
+	executor.Start();
+	executor.Submit(&workflow);
+
+	Check(WaitFor([&]{ return *workflow.Stage == 2; }), "Condition: a ready condition does not suspend the workflow.");
+
+	executor.Stop();
+	executor.Join();
+}
+
+int main()
+{
+	TestResumeAllWaiters();
+	TestReadyCondition();
+	return Tests::GetExitCode();
+}
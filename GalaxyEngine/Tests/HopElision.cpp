@@ -0,0 +1,145 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <atomic>
+#include "TestTools.hpp"
+
+/// 同一执行器上相邻流处理器连续执行的行为测试
+
+using namespace Galaxy;
+using Galaxy::Tests::Check;
+using Galaxy::Tests::WaitFor;
+
+/// 记录执行次数的流处理器
+class StepProcessor AsProcessor
+{
+Requirement:
+	Require(int, Steps);
+
+	Process
+	{
+		++*Steps;
+	}
+};
+
+/// 五个流处理器都位于同一执行器上的工作流
+class LocalFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Steps Provide(0, "Steps");
+
+Procedure:
+	StepProcessor First On(Main);
+	StepProcessor Second On(Main);
+	StepProcessor Third On(Main);
+	StepProcessor Fourth On(Main);
+	StepProcessor Fifth On(Main);
+
+public:
+	/// 迭代是否已经结束
+	std::atomic_bool Finished {false};
+
+	LocalFlow()
+	{
+		OnEnd = [this]{ Finished = true; };
+	}
+};
+
+/// 中间的流处理器位于另一执行器上的工作流
+class CrossingFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+	NeedSerialExecutor(Other) {};
+
+Channels:
+	Galaxy::Channel<int> Steps Provide(0, "Steps");
+
+Procedure:
+	StepProcessor First On(Main);
+	StepProcessor Second On(Other);
+	StepProcessor Third On(Main);
+
+public:
+	/// 迭代是否已经结束
+	std::atomic_bool Finished {false};
+
+	CrossingFlow()
+	{
+		OnEnd = [this]{ Finished = true; };
+	}
+};
+
+/// 执行一次迭代，返回执行器收到的提交次数
+std::uint64_t RunLocalFlow(unsigned int max_inline_hops, std::uint64_t& inlined_hops)
+{
+	SerialExecutor executor;
+	executor.SetMaxInlineHops(max_inline_hops);
+	LocalFlow workflow;
+	workflow.Main = &executor;
+
+	executor.Start();
+	executor.Submit(&workflow);
+	Check(WaitFor([&workflow]{ return workflow.Finished.load(); }), "Hops: the workflow finishes its iteration.");
+	executor.Stop();
+	executor.Join();
+
+	Check(*workflow.Steps == 5, "Hops: every processor is executed exactly once.");
+	inlined_hops = executor.GetInlinedHopsCount();
+	return executor.GetQueueStatistics().Submitted;
+}
+
+/// 相邻且位于同一执行器上的流处理器直接连续执行，不重新排队
+void TestInlineHops()
+{
+	std::uint64_t inlined_hops = 0;
+	auto submitted = RunLocalFlow(16, inlined_hops);
+	Check(submitted == 1, "Hops: only the initial submission is queued.");
+	Check(inlined_hops >= 4, "Hops: hops between local processors are inlined.");
+}
+
+/// 连续执行的次数达到上限后重新排队
+void TestInlineHopsLimit()
+{
+	std::uint64_t unlimited_hops = 0, limited_hops = 0, disabled_hops = 0;
+	auto unlimited_submitted = RunLocalFlow(16, unlimited_hops);
+	auto limited_submitted = RunLocalFlow(1, limited_hops);
+	auto disabled_submitted = RunLocalFlow(0, disabled_hops);
+
+	Check(disabled_hops == 0, "Hops: no hop is inlined when the limit is 0.");
+	Check(disabled_submitted == unlimited_submitted + unlimited_hops,
+		  "Hops: every hop is queued again when the limit is 0.");
+	Check(limited_submitted > unlimited_submitted && limited_submitted < disabled_submitted,
+		  "Hops: the workflow is queued again each time the limit is reached.");
+}
+
+/// 切换执行器的跳转不会被直接执行
+void TestCrossingHops()
+{
+	SerialExecutor main_executor, other_executor;
+	CrossingFlow workflow;
+	workflow.Main = &main_executor;
+	workflow.Other = &other_executor;
+
+	main_executor.Start();
+	other_executor.Start();
+	main_executor.Submit(&workflow);
+	Check(WaitFor([&workflow]{ return workflow.Finished.load(); }), "Hops: the crossing workflow finishes.");
+	main_executor.Stop();
+	other_executor.Stop();
+	main_executor.Join();
+	other_executor.Join();
+
+	Check(*workflow.Steps == 3, "Hops: every crossing processor is executed exactly once.");
+	Check(other_executor.GetQueueStatistics().Submitted == 1, "Hops: the other executor receives the workflow once.");
+	Check(main_executor.GetQueueStatistics().Submitted == 2, "Hops: the workflow comes back to its first executor.");
+}
+
+int main()
+{
+	TestInlineHops();
+	TestInlineHopsLimit();
+	TestCrossingHops();
+	return Tests::GetExitCode();
+}
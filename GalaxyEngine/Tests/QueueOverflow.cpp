@@ -0,0 +1,224 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <algorithm>
+#include <initializer_list>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "TestTools.hpp"
+
+/// 执行器队列容量与溢出策略的行为测试
+
+using namespace Galaxy;
+using Galaxy::Tests::Check;
+using Galaxy::Tests::WaitFor;
+using OverflowPolicy = Core::AbstractExecutor::OverflowPolicy;
+
+/// 记录执行次数的流处理器
+class CountProcessor AsProcessor
+{
+Requirement:
+	Require(int, Done);
+
+	Process
+	{
+		++*Done;
+	}
+};
+
+/// 执行较慢的流处理器
+class SlowProcessor AsProcessor
+{
+Requirement:
+	Require(int, Done);
+
+	Process
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		++*Done;
+	}
+};
+
+/// 计数工作流
+class CountFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Done Provide(0, "Done");
+
+Procedure:
+	CountProcessor Count On(Main);
+
+public:
+	/// 结束的次数，包括被放弃的迭代
+	std::atomic_int EndsCount {0};
+
+	CountFlow()
+	{
+		OnEnd = [this]{ ++EndsCount; };
+	}
+};
+
+/// 另一种类型的计数工作流，不与CountFlow合并
+class OtherCountFlow : public CountFlow
+{};
+
+/// 较慢的工作流
+class SlowFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Done Provide(0, "Done");
+
+Procedure:
+	SlowProcessor Slow On(Main);
+};
+
+/// 启动执行器并等待其执行完所有任务后停止
+void RunUntilIdle(SerialExecutor& executor)
+{
+	executor.Start();
+	WaitFor([&executor]{ return executor.GetQueuedTasksCount() == 0; });
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	executor.Stop();
+	executor.Join();
+}
+
+/// 队列已满时拒绝新提交的工作流
+void TestReject()
+{
+	SerialExecutor executor;
+	executor.SetQueueCapacity(2, OverflowPolicy::Reject);
+	CountFlow first, second, third;
+	for (auto* workflow : {&first, &second, &third})
+	{
+		workflow->Main = &executor;
+		executor.Submit(workflow);
+	}
+	Check(executor.GetQueueStatistics().Rejected == 1, "Reject: one submission is rejected.");
+	Check(executor.GetQueuedTasksCount() == 2, "Reject: queue holds no more than its capacity.");
+
+	RunUntilIdle(executor);
+	Check(*first.Done == 1 && *second.Done == 1, "Reject: admitted workflows are executed.");
+	Check(*third.Done == 0, "Reject: rejected workflow is not executed.");
+	Check(third.EndsCount == 1, "Reject: rejected workflow ends its iteration.");
+}
+
+/// 队列已满时放弃最早的排队者
+void TestDropOldest()
+{
+	SerialExecutor executor;
+	executor.SetQueueCapacity(2, OverflowPolicy::DropOldest);
+	CountFlow first, second, third;
+	for (auto* workflow : {&first, &second, &third})
+	{
+		workflow->Main = &executor;
+		executor.Submit(workflow);
+	}
+	Check(executor.GetQueueStatistics().Dropped == 1, "DropOldest: one queued workflow is dropped.");
+	Check(executor.GetQueuedTasksCount() == 2, "DropOldest: queue holds no more than its capacity.");
+
+	RunUntilIdle(executor);
+	Check(*first.Done == 0 && first.EndsCount == 1, "DropOldest: the oldest workflow is discarded.");
+	Check(*second.Done == 1 && *third.Done == 1, "DropOldest: newer workflows are executed.");
+}
+
+/// 同类型的工作流至多排队一个
+void TestCoalesce()
+{
+	SerialExecutor executor;
+	executor.SetQueueCapacity(0, OverflowPolicy::Coalesce);
+	CountFlow first, second;
+	OtherCountFlow other;
+	for (CountFlow* workflow : std::initializer_list<CountFlow*>{&first, &other, &second})
+	{
+		workflow->Main = &executor;
+		executor.Submit(workflow);
+	}
+	Check(executor.GetQueueStatistics().Coalesced == 1, "Coalesce: one queued workflow is superseded.");
+
+	RunUntilIdle(executor);
+	Check(*first.Done == 0 && first.EndsCount == 1, "Coalesce: the superseded workflow is discarded.");
+	Check(*second.Done == 1, "Coalesce: the latest workflow of a type is executed.");
+	Check(*other.Done == 1, "Coalesce: workflows of other types are not superseded.");
+}
+
+/// 两个循环的同类型工作流在合并策略下都能完成迭代
+void TestCoalesceLoopingWorkflows()
+{
+	constexpr int iterations = 50;
+	SerialExecutor executor;
+	executor.SetQueueCapacity(0, OverflowPolicy::Coalesce);
+	CountFlow first, second;
+	for (auto* workflow : {&first, &second})
+	{
+		workflow->Main = &executor;
+		workflow->Loop = true;
+		workflow->LoopStopCondition = [workflow]{ return *workflow->Done >= iterations; };
+	}
+	executor.Start();
+	executor.Submit(&first);
+	executor.Submit(&second);
+
+	bool finished = WaitFor([&]{ return *first.Done >= iterations && *second.Done >= iterations; });
+	Check(finished, "Coalesce: looping workflows of the same type keep making progress.");
+
+	first.Loop = second.Loop = false;
+	executor.Stop();
+	executor.Join();
+}
+
+/// 队列已满时阻塞提交者，直到名额空出
+void TestBlock()
+{
+	constexpr int workflows_count = 20;
+	SerialExecutor executor;
+	executor.SetQueueCapacity(1, OverflowPolicy::Block);
+	std::vector<SlowFlow> workflows(workflows_count);
+	for (auto& workflow : workflows)
+	{
+		workflow.Main = &executor;
+	}
+	// 执行器尚未开始工作时不会阻塞提交者
+	executor.Start();
+	WaitFor([&executor]{ return executor.IsWorking(); });
+
+	std::atomic_bool submitting {true};
+	std::size_t max_queued_count = 0;
+	std::thread monitor([&]{
+		while (submitting)
+		{
+			max_queued_count = std::max(max_queued_count, executor.GetQueuedTasksCount());
+			std::this_thread::yield();
+		}
+	});
+	for (auto& workflow : workflows)
+	{
+		executor.Submit(&workflow);
+	}
+	submitting = false;
+	monitor.join();
+
+	bool finished = WaitFor([&]{
+		return std::all_of(workflows.begin(), workflows.end(), [](auto& workflow){ return *workflow.Done == 1; });
+	});
+	Check(finished, "Block: every submission is executed.");
+	Check(max_queued_count <= 1, "Block: queue never exceeds its capacity.");
+	Check(executor.GetQueueStatistics().Blocked > 0, "Block: submitter is blocked while the queue is full.");
+
+	executor.Stop();
+	executor.Join();
+}
+
+int main()
+{
+	TestReject();
+	TestDropOldest();
+	TestCoalesce();
+	TestCoalesceLoopingWorkflows();
+	TestBlock();
+	return Tests::GetExitCode();
+}
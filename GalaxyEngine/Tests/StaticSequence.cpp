@@ -0,0 +1,111 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <stdexcept>
+#include "TestTools.hpp"
+
+/// 静态序列通道绑定的行为测试
+
+using namespace Galaxy;
+using Galaxy::Tests::Check;
+using Galaxy::Tests::WaitFor;
+
+StaticChannel(int, Input);
+StaticInternalChannel(int, Doubled);
+StaticChannel(int, Output);
+
+/// 将输入加倍
+struct DoubleStep
+{
+	void Execute(const int& input, int& output)
+	{
+		output = input * 2;
+	}
+};
+
+/// 在输入上加上偏移量
+struct OffsetStep
+{
+	int Offset = 0;
+
+	void Execute(const int& input, int& output)
+	{
+		output = input + Offset;
+	}
+};
+
+using Arithmetic = Static::Sequence<Static::ChannelSet<Input, Doubled, Output>,
+	Static::Step<DoubleStep, Static::ReadOnly<Input>, Doubled>,
+	Static::Step<OffsetStep, Static::ReadOnly<Doubled>, Output>>;
+
+/// 声明了所有非内部通道的工作流
+class ArithmeticFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Input Provide(21, "Input");
+	Galaxy::Channel<int> Output Provide(0, "Output");
+
+Procedure:
+	Arithmetic Calculate On(Main);
+};
+
+/// 缺少输出通道的工作流
+class MissingOutputFlow AsWorkflow
+{
+Executors:
+	NeedSerialExecutor(Main) {};
+
+Channels:
+	Galaxy::Channel<int> Input Provide(21, "Input");
+
+Procedure:
+	Arithmetic Calculate On(Main);
+};
+
+/// 标签绑定到工作流中同名的通道，内部通道在步骤之间传递
+void TestBinding()
+{
+	SerialExecutor executor;
+	ArithmeticFlow workflow;
+	workflow.Main = &executor;
+	workflow.Calculate.GetStep<1>().Offset = 3;
+	std::atomic_bool finished {false};
+	workflow.OnEnd = [&finished]{ finished = true; };
+
+	executor.Start();
+	executor.Submit(&workflow);
+	Check(WaitFor([&finished]{ return finished.load(); }), "Binding: the workflow finishes its iteration.");
+	executor.Stop();
+	executor.Join();
+
+	Check(*workflow.Output == 45, "Binding: steps read and write the workflow channels.");
+	Check(workflow.Calculate.Acquire<Output>() == 45, "Binding: Acquire returns the mounted channel value.");
+	Check(workflow.Calculate.Acquire<Doubled>() == 42, "Binding: internal channel passes values between steps.");
+}
+
+/// 非内部通道未挂载时，工作流在初始化时抛出异常
+void TestMissingChannel()
+{
+	SerialExecutor executor;
+	MissingOutputFlow workflow;
+	workflow.Main = &executor;
+
+	bool thrown = false;
+	try
+	{
+		Core::Tools::WorkflowAccess::Initialize(&workflow);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	Check(thrown, "Binding: a tag without a channel of the same name fails the initialization.");
+}
+
+int main()
+{
+	TestBinding();
+	TestMissingChannel();
+	return Tests::GetExitCode();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+/// 行为测试共用的检查工具
+
+namespace Galaxy::Tests
+{
+	/// 失败的检查数量
+	inline int FailedChecksCount = 0;
+
+	/**
+	 * @brief 检查条件
+	 * @param condition 条件
+	 * @param description 条件的描述，失败时输出
+	 */
+	inline void Check(bool condition, const char* description)
+	{
+		if (!condition)
+		{
+			++FailedChecksCount;
+			std::cerr << "[Failed] " << description << std::endl;
+		}
+	}
+
+	/**
+	 * @brief 等待条件成立
+	 * @param condition 条件
+	 * @param timeout 最长等待时间
+	 * @return 超时前条件是否成立
+	 */
+	inline bool WaitFor(const std::function<bool()>& condition,
+						std::chrono::milliseconds timeout = std::chrono::milliseconds(5000))
+	{
+		auto deadline = std::chrono::steady_clock::now() + timeout;
+		while (!condition())
+		{
+			if (std::chrono::steady_clock::now() > deadline) return false;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 获取测试程序的返回值
+	 * @return 所有检查都通过时为0，否则为1
+	 */
+	inline int GetExitCode()
+	{
+		return FailedChecksCount == 0 ? 0 : 1;
+	}
+}
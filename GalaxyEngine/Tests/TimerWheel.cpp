@@ -0,0 +1,115 @@
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "TestTools.hpp"
+
+/// 计时执行器时间轮到期的行为测试
+
+using namespace Galaxy;
+using Galaxy::Tests::Check;
+using Galaxy::Tests::WaitFor;
+
+/// 休眠后醒来的工作流
+class SleepingFlow AsWorkflow
+{
+Executors:
+	NeedTimerExecutor(Timer) {};
+	NeedSerialExecutor(Main) {};
+
+Procedure:
+	BuiltIn::SleepAction Sleep On(Timer, std::chrono::milliseconds(0));
+	BuiltIn::LambdaAction Wake On(Main, [this]{
+		WakeTime = std::chrono::steady_clock::now();
+		Woken = true;
+	});
+
+public:
+	/// 醒来的时刻
+	std::chrono::steady_clock::time_point WakeTime {};
+	/// 是否已经醒来
+	std::atomic_bool Woken {false};
+};
+
+/// 休眠的工作流不早于到期时间醒来，且按照到期时间的顺序醒来
+void TestSleepOrder()
+{
+	// 以1毫秒为刻度，较长的休眠需要从高层时间轮级联
+	const std::vector<std::chrono::milliseconds> durations {
+		std::chrono::milliseconds(150), std::chrono::milliseconds(10), std::chrono::milliseconds(80)};
+
+	TimerExecutor timer;
+	SerialExecutor main_executor;
+	std::vector<std::unique_ptr<SleepingFlow>> workflows;
+	for (auto duration : durations)
+	{
+		auto workflow = std::make_unique<SleepingFlow>();
+		workflow->Timer = &timer;
+		workflow->Main = &main_executor;
+		workflow->Sleep.Duration = duration;
+		workflows.push_back(std::move(workflow));
+	}
+
+	timer.Start();
+	main_executor.Start();
+	auto begin = std::chrono::steady_clock::now();
+	for (auto& workflow : workflows)
+	{
+		timer.Submit(workflow.get());
+	}
+
+	bool finished = WaitFor([&workflows]{
+		for (auto& workflow : workflows)
+		{
+			if (!workflow->Woken) return false;
+		}
+		return true;
+	});
+	Check(finished, "Timer: every sleeping workflow wakes up.");
+	Check(timer.IsEmpty(), "Timer: no workflow stays parked after waking up.");
+
+	timer.Stop();
+	main_executor.Stop();
+	timer.Join();
+	main_executor.Join();
+
+	if (!finished) return;
+	for (std::size_t index = 0; index < durations.size(); ++index)
+	{
+		Check(workflows[index]->WakeTime - begin >= durations[index], "Timer: no workflow wakes up early.");
+	}
+	Check(workflows[1]->WakeTime < workflows[2]->WakeTime &&
+		  workflows[2]->WakeTime < workflows[0]->WakeTime, "Timer: workflows wake up in order of due time.");
+}
+
+/// 预约的回调在到期后调用一次
+void TestScheduledCallback()
+{
+	TimerExecutor timer;
+	timer.Start();
+
+	std::atomic_int calls {0};
+	auto begin = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point call_time {};
+	timer.ScheduleCallback(begin + std::chrono::milliseconds(20), [&]{
+		call_time = std::chrono::steady_clock::now();
+		++calls;
+	});
+
+	Check(WaitFor([&calls]{ return calls.load() > 0; }), "Timer: the scheduled callback is called.");
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	Check(calls == 1, "Timer: the scheduled callback is called exactly once.");
+	Check(call_time - begin >= std::chrono::milliseconds(20), "Timer: the callback is not called early.");
+
+	timer.Stop();
+	timer.Join();
+}
+
+int main()
+{
+	TestSleepOrder();
+	TestScheduledCallback();
+	return Tests::GetExitCode();
+}
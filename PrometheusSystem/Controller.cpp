@@ -1,9 +1,11 @@
 #include "Controller.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <thread>
 #include <boost/filesystem.hpp>
-#include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
 namespace RoboPioneers::Prometheus
@@ -11,10 +13,35 @@ namespace RoboPioneers::Prometheus
 	/// 启动方法
 	void Controller::Launch()
 	{
+		//==============================
+		// 构建执行器
+		//==============================
+
+		BuildExecutors();
+
 		//==============================
 		// 准备工作流
 		//==============================
 
+		LoadPipelineSettings();
+
+		if (PipelineDepth > 1)
+		{
+			std::vector<Galaxy::Core::AbstractWorkflow*> slots {&SecondFrame, &ThirdFrame};
+			slots.resize(PipelineDepth - 1);
+			FirstFrame.PipelineSlots = slots;
+		}
+
+		//==============================
+		// 预留帧缓冲
+		//==============================
+
+		LoadMemorySettings();
+
+		// 每帧各需要一张全尺寸的二值图，在启动时映射并缺页，使得运行期间不再申请内存
+		Modules::FramePool::GetInstance()->UseHugePages = UseHugePages;
+		Modules::FramePool::GetInstance()->Reserve(cv::Size(1280, 1024), CV_8UC1, PipelineDepth);
+
 		for (int index = 0; index < Frames.size(); ++index)
 		{
 			auto& frame = Frames[index];
@@ -39,28 +66,204 @@ namespace RoboPioneers::Prometheus
 			std::this_thread::sleep_for(std::chrono::milliseconds(1));
 		}
 
+		//==============================
+		// 设置调度选项
+		//==============================
+
+		LoadSchedulingSettings();
+
+		if (EnableRealtimeScheduling)
+		{
+			Galaxy::Core::AbstractExecutor::SchedulingOptions options;
+			options.Policy = Galaxy::Core::AbstractExecutor::SchedulingOptions::PolicyType::FIFO;
+			options.RealtimePriority = RealtimePriority;
+			options.LockMemory = true;
+			options.PrefaultStackSize = 512 * 1024;
+
+			MainCore->SetSchedulingOptions(options);
+			ViceCore->SetSchedulingOptions(options);
+		}
+
 		//==============================
 		// 注册、启动并阻塞执行器
 		//==============================
 
-		Galaxy::Runtime::GetInstance()->RegisterExecutors({&A57, &Denver1, &Denver2});
+		Galaxy::Runtime::GetInstance()->RegisterExecutors(Cores->GetAll());
+
+		Cores->StartAll();
+
+		Cores->JoinAll();
+	}
+
+	/// 判断是否运行在Jetson TX2上
+	bool Controller::IsRunningOnTX2()
+	{
+		// TX2的设备树兼容列表中包含其芯片tegra186
+		std::ifstream file("/proc/device-tree/compatible", std::ios::binary);
+		std::string compatible((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		return compatible.find("tegra186") != std::string::npos;
+	}
+
+	/// 查找拓扑文件
+	std::optional<std::string> Controller::FindTopologyFile()
+	{
+		if (boost::filesystem::exists("Topology.json"))
+		{
+			return "Topology.json";
+		}
+		if (!IsRunningOnTX2())
+		{
+			return std::nullopt;
+		}
+
+		// TX2的拓扑文件在构建时被复制到可执行文件旁
+		if (boost::filesystem::exists("Topology.TX2.json"))
+		{
+			return "Topology.TX2.json";
+		}
+		boost::system::error_code error;
+		auto executable = boost::filesystem::read_symlink("/proc/self/exe", error);
+		if (!error)
+		{
+			auto path = executable.parent_path() / "Topology.TX2.json";
+			if (boost::filesystem::exists(path))
+			{
+				return path.string();
+			}
+		}
+		return std::nullopt;
+	}
+
+	/// 获取固定的处理器拓扑
+	Galaxy::CPUTopology Controller::MakeFixedTopology()
+	{
+		// 与Topology.TX2.json相同：丹佛双核1、2为大核，A57四核0、3、4、5为一簇
+		std::vector<Galaxy::CPUTopology::ProcessorInfo> processors;
+		for (unsigned int index = 0; index < 6; ++index)
+		{
+			Galaxy::CPUTopology::ProcessorInfo info;
+			info.Index = index;
+			bool denver = index == 1 || index == 2;
+			info.Package = denver ? 0 : 1;
+			info.Capacity = denver ? 1024 : 512;
+			processors.push_back(info);
+		}
+		return Galaxy::CPUTopology::Create(std::move(processors));
+	}
+
+	/// 根据处理器拓扑构建执行器
+	void Controller::BuildExecutors()
+	{
+		if (auto path = FindTopologyFile())
+		{
+			Galaxy::Runtime::GetInstance()->LoadTopology(*path);
+			std::clog << "[Message] Using Topology in " << *path << "." << std::endl;
+		}
+
+		auto topology = Galaxy::Runtime::GetInstance()->GetTopology();
+
+		// 无法区分大小核时不猜测布局：例如TX2的L4T内核不提供cpu_capacity，且两个簇的最高频率相同
+		if (!topology.HasFastCluster())
+		{
+			auto online = topology.GetOnlineProcessors();
+			bool fixed_layout_available = std::all_of(FixedLayoutProcessors.begin(), FixedLayoutProcessors.end(),
+				[&online](unsigned int index){
+				return std::find(online.begin(), online.end(), index) != online.end();
+			});
+			if (fixed_layout_available)
+			{
+				std::cerr << "[Warning] No Fast CPU Cluster Detected, Fall Back to Fixed Layout: "
+					"Main Core 1, Vice Core 2, Multiple Cores 0, 3, 4, 5." << std::endl;
+				topology = MakeFixedTopology();
+			}
+			else
+			{
+				std::cerr << "[Warning] No Fast CPU Cluster Detected, "
+					"Big Cores will be Taken from the Largest Cluster." << std::endl;
+			}
+		}
+
+		// 主大核和副大核各需要一个串行执行器
+		Cores = std::make_unique<Galaxy::ExecutorSet>(topology, 2);
+
+		MultiCores = Cores->LittleClusters.front();
+		MainCore = Cores->BigCores[0];
+		ViceCore = Cores->BigCores[1];
+	}
+
+	/// 获取配置文件中的设定
+	const std::optional<boost::property_tree::ptree>& Controller::GetSettings()
+	{
+		if (!SettingsLoaded)
+		{
+			SettingsLoaded = true;
+			if (boost::filesystem::exists("Settings.json"))
+			{
+				Settings.emplace();
+				boost::property_tree::read_json("Settings.json", *Settings);
+			}
+		}
+		return Settings;
+	}
 
-		A57.Start();
-		Denver1.Start();
-		Denver2.Start();
+	/// 从配置文件中加载调度设定
+	void Controller::LoadSchedulingSettings()
+	{
+		if (const auto& settings = GetSettings())
+		{
+			const auto& json_node = *settings;
+
+			// 调度设定是可选的，缺省时保持普通调度
+			EnableRealtimeScheduling = json_node.get<bool>("Scheduling.Realtime", EnableRealtimeScheduling);
+			RealtimePriority = json_node.get<int>("Scheduling.Priority", RealtimePriority);
+
+			if (EnableRealtimeScheduling)
+			{
+				std::clog << "[Message] Real-time Scheduling Enabled with Priority " << RealtimePriority << "." << std::endl;
+			}
+		}
+	}
+
+	/// 从配置文件中加载流水线设定
+	void Controller::LoadPipelineSettings()
+	{
+		if (const auto& settings = GetSettings())
+		{
+			const auto& json_node = *settings;
+
+			// 流水线设定是可选的，缺省时不启用帧流水线
+			PipelineDepth = std::clamp(json_node.get<unsigned int>("Pipeline.Depth", PipelineDepth), 1u, 3u);
 
-		A57.Join();
-		Denver1.Join();
-		Denver2.Join();
+			if (PipelineDepth > 1)
+			{
+				std::clog << "[Message] Frame Pipeline Enabled with Depth " << PipelineDepth << "." << std::endl;
+			}
+		}
+	}
+
+	/// 从配置文件中加载内存设定
+	void Controller::LoadMemorySettings()
+	{
+		if (const auto& settings = GetSettings())
+		{
+			const auto& json_node = *settings;
+
+			// 内存设定是可选的，缺省时使用普通页
+			UseHugePages = json_node.get<bool>("Memory.HugePages", UseHugePages);
+
+			if (UseHugePages)
+			{
+				std::clog << "[Message] Huge Pages Enabled for Frame Buffers." << std::endl;
+			}
+		}
 	}
 
 	void Controller::LoadSettings(FrameworkFlow* frame)
 	{
 		// 确保日志路径存在
-		if(boost::filesystem::exists("Settings.json"))
+		if (const auto& settings = GetSettings())
 		{
-			boost::property_tree::ptree json_node;
-			boost::property_tree::read_json("Settings.json", json_node);
+			const auto& json_node = *settings;
 
 			frame->ColorPerception.ColorForRed.MinHue = json_node.get<int>("Mask.Red.Hue.Min");
 			frame->ColorPerception.ColorForRed.MaxHue = json_node.get<int>("Mask.Red.Hue.Max");
@@ -85,6 +288,18 @@ namespace RoboPioneers::Prometheus
 			frame->MatchArmors.MinWidthDistanceRatioSmallArmor = json_node.get<int>("SmallArmor.WidthDistanceRatio.Min");
 			frame->MatchArmors.MaxWidthDistanceRatioSmallArmor = json_node.get<int>("SmallArmor.WidthDistanceRatio.Max");
 
+			// 帧时间预算是可选的，设置为0时不限制帧的耗时
+			auto budget = json_node.get<int>("Frame.BudgetMilliseconds",
+				FrameworkFlow::DefaultFrameBudgetMilliseconds);
+			if (budget > 0)
+			{
+				frame->FrameBudget = std::chrono::milliseconds(budget);
+			}
+			else
+			{
+				frame->FrameBudget.reset();
+			}
+
 			std::clog << "[Message] Using Settings in Settings.json." << std::endl;
 		}
 	}
@@ -104,7 +319,15 @@ namespace RoboPioneers::Prometheus
 		if (std::chrono::duration_cast<std::chrono::seconds>(current_time - FrameLastRecordTime).count() >= 1)
 		{
 			FrameLastRecordTime = current_time;
-			std::cout << "FPS: " << FramesCount << std::endl;
+
+			std::size_t expired_frames_count = 0;
+			for (auto* frame : Frames)
+			{
+				expired_frames_count += frame->GetExpiredFramesCount();
+			}
+			std::cout << "FPS: " << FramesCount
+				<< " Expired: " << expired_frames_count - ExpiredFramesLastRecordCount << std::endl;
+			ExpiredFramesLastRecordCount = expired_frames_count;
 			FramesCount = 0;
 		}
 
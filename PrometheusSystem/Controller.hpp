@@ -3,8 +3,13 @@
 #include <GalaxyEngine/GalaxyEngine.hpp>
 #include <chrono>
 #include <vector>
+#include <array>
 #include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
 #include <tbb/tbb.h>
+#include <boost/property_tree/ptree.hpp>
 #include "Workflows/FrameworkFlow.hpp"
 
 namespace RoboPioneers::Prometheus
@@ -18,19 +23,22 @@ namespace RoboPioneers::Prometheus
 	class Controller
 	{
 	protected:
-		/// A57 四核处理器
-		Galaxy::ParallelExecutor A57 {0,3,4,5};
-		/// 丹佛大核处理器1号
-		Galaxy::SerialExecutor Denver1 {1};
-		/// 丹佛大核处理器2号
-		Galaxy::SerialExecutor Denver2 {2};
+		/**
+		 * @brief 执行器集合
+		 * @details
+		 *  ~ 启动时根据处理器拓扑构建，若工作目录下存在Topology.json，则使用其中描述的拓扑。
+		 *  ~ Topology.TX2.json描述了Jetson TX2的拓扑，构建时被复制到可执行文件旁，在TX2上运行且没有Topology.json时自动使用；
+		 *    使用该拓扑时，两个丹佛大核各对应一个串行执行器，A57四核对应一个并行执行器。
+		 *  ~ 拓扑无法区分大小核且处理器0至5均在线时，将回退到与TX2相同的固定布局，并给出警告。
+		 */
+		std::unique_ptr<Galaxy::ExecutorSet> Cores;
 
 		/// 多核指针
-		Galaxy::ParallelExecutor* MultiCores{&A57};
+		Galaxy::ParallelExecutor* MultiCores{nullptr};
 		/// 主大核的指针
-		Galaxy::SerialExecutor* MainCore{&Denver1};
+		Galaxy::SerialExecutor* MainCore{nullptr};
 		/// 副大核的指针
-		Galaxy::SerialExecutor* ViceCore{&Denver2};
+		Galaxy::SerialExecutor* ViceCore{nullptr};
 
 		/// 第一工作流
 		FrameworkFlow FirstFrame;
@@ -40,22 +48,88 @@ namespace RoboPioneers::Prometheus
 		FrameworkFlow ThirdFrame;
 
 	private:
+		/// 固定布局所使用的处理器
+		static constexpr std::array<unsigned int, 6> FixedLayoutProcessors {0, 1, 2, 3, 4, 5};
+
 		/// 上次记录时间
 		std::chrono::steady_clock::time_point FrameLastRecordTime;
 		/// 从上次记录时间开始经过的帧数
 		unsigned int FramesCount {0};
+		/// 上次记录时超时放弃的总帧数
+		std::size_t ExpiredFramesLastRecordCount {0};
+
+		/// 配置文件中的设定，首次访问时读取
+		std::optional<boost::property_tree::ptree> Settings;
+		/// 配置文件是否已经读取
+		bool SettingsLoaded {false};
 
 	protected:
 		/**
 		 * @brief 帧队列
-		 * @details 注意，开了帧重叠反而是负优化
+		 * @details
+		 *  ~ 多个工作流各自独立循环时会争抢同一个流处理器的执行器，且输出顺序无法保证，反而是负优化；
+		 *    需要帧重叠时应使用流水线深度设定。
 		 */
 		std::vector<FrameworkFlow*> Frames {&FirstFrame};
 
+		/**
+		 * @brief 流水线深度
+		 * @details
+		 *  ~ 同时处理的帧数，取值为1至3，1表示不启用帧流水线。
+		 *  ~ 大于1时，第二、第三工作流将作为第一工作流的流水线通道组，使下一帧的预处理与本帧的识别同时进行。
+		 */
+		unsigned int PipelineDepth {1};
+
+		/**
+		 * @brief 是否为大核启用实时调度
+		 * @details
+		 *  ~ 启用后大核执行器将使用SCHED_FIFO调度并锁定内存，以免被后台进程抢占；缺少权限时将自动回退。
+		 */
+		bool EnableRealtimeScheduling {false};
+		/// 大核执行器的实时优先级
+		int RealtimePriority {80};
+
+		/**
+		 * @brief 帧缓冲是否使用大页
+		 * @details
+		 *  ~ 启用后帧缓冲池将优先使用预留的大页，以减少TLB缺失；系统未预留大页时将回退为透明大页。
+		 */
+		bool UseHugePages {false};
+
 	public:
+		/**
+		 * @brief 获取配置文件中的设定
+		 * @return 可选，首次调用时读取工作目录下的Settings.json，此后返回同一份设定；文件不存在时为std::nullopt
+		 */
+		const std::optional<boost::property_tree::ptree>& GetSettings();
+
 		/// 从配置文件中加载设定
 		void LoadSettings(FrameworkFlow* frame);
 
+		/// 从配置文件中加载调度设定
+		void LoadSchedulingSettings();
+
+		/// 从配置文件中加载流水线设定
+		void LoadPipelineSettings();
+
+		/// 从配置文件中加载内存设定
+		void LoadMemorySettings();
+
+		/// 根据处理器拓扑构建执行器
+		void BuildExecutors();
+
+		/// 判断是否运行在Jetson TX2上
+		static bool IsRunningOnTX2();
+
+		/**
+		 * @brief 查找拓扑文件
+		 * @return 可选，依次查找工作目录下的Topology.json，以及在TX2上运行时的Topology.TX2.json，均不存在时返回std::nullopt
+		 */
+		static std::optional<std::string> FindTopologyFile();
+
+		/// 获取与Topology.TX2.json相同的固定拓扑，用于无法区分大小核时回退
+		static Galaxy::CPUTopology MakeFixedTopology();
+
 		/// 帧第一阶段结束事件
 		virtual void OnFrameFirstStageFinished(unsigned int frame_index);
 
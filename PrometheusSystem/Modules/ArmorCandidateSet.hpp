@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RoboPioneers::Modules
+{
+	/**
+	 * @brief 装甲板候选集合
+	 * @author Vincent
+	 * @details
+	 *  ~ 每个候选由两个灯条组成，只存放两个灯条在灯条集合中的下标，不复制旋转矩形；
+	 *    读取候选时需要同时访问其所引用的灯条集合。
+	 *  ~ 以结构数组的形式连续存放，使用多态分配器，可以作为帧通道的值。
+	 */
+	class ArmorCandidateSet
+	{
+	public:
+		/// 第一个灯条的下标
+		std::pmr::vector<std::uint32_t> FirstIndices;
+		/// 第二个灯条的下标
+		std::pmr::vector<std::uint32_t> SecondIndices;
+
+		/**
+		 * @brief 构造函数
+		 * @param resource 内存资源
+		 */
+		explicit ArmorCandidateSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+			FirstIndices(resource), SecondIndices(resource)
+		{}
+
+		/**
+		 * @brief 获取候选数量
+		 * @return 候选数量
+		 */
+		[[nodiscard]] std::size_t GetCount() const
+		{
+			return FirstIndices.size();
+		}
+
+		/**
+		 * @brief 查询是否为空
+		 * @retval true 没有候选
+		 * @retval false 至少有一个候选
+		 */
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return FirstIndices.empty();
+		}
+
+		/// 清空集合
+		void Clear()
+		{
+			FirstIndices.clear();
+			SecondIndices.clear();
+		}
+
+		/**
+		 * @brief 添加候选
+		 * @param first_index 第一个灯条的下标
+		 * @param second_index 第二个灯条的下标
+		 */
+		void Add(std::size_t first_index, std::size_t second_index)
+		{
+			FirstIndices.push_back(static_cast<std::uint32_t>(first_index));
+			SecondIndices.push_back(static_cast<std::uint32_t>(second_index));
+		}
+	};
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <vector>
+#include <opencv4/opencv2/opencv.hpp>
+
+namespace RoboPioneers::Modules
+{
+	/**
+	 * @brief 轮廓列表
+	 * @details
+	 *  ~ OpenCV只能向使用默认分配器的容器输出轮廓，故不使用多态分配器，以便轮廓检测直接输出到通道中，无需逐帧复制。
+	 *  ~ 作为普通通道的值在各帧之间复用，其容量稳定后不再分配内存。
+	 */
+	using ContourList = std::vector<std::vector<cv::Point2i>>;
+}
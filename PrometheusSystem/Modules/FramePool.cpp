@@ -0,0 +1,195 @@
+#include "FramePool.hpp"
+
+#include <sys/mman.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace RoboPioneers::Modules
+{
+	/// 普通页的大小
+	static constexpr std::size_t PageSize = 4096;
+	/// 大页的大小
+	static constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+	/// 析构函数
+	FramePool::~FramePool()
+	{
+		for (auto& [address, length] : Mappings)
+		{
+			munmap(address, length);
+		}
+	}
+
+	/// 获取全局帧缓冲池
+	FramePool* FramePool::GetInstance()
+	{
+		static FramePool pool;
+		return &pool;
+	}
+
+	/// 获取字节数对应的桶容量
+	std::size_t FramePool::GetBucketCapacity(std::size_t bytes)
+	{
+		std::size_t capacity = PageSize;
+		while (capacity < bytes)
+		{
+			capacity <<= 1u;
+		}
+		return capacity;
+	}
+
+	/// 映射新的缓冲
+	void* FramePool::MapBuffer(std::size_t capacity) const
+	{
+		void* address = MAP_FAILED;
+
+		// 只有不小于大页的桶才使用大页，否则一个大页只能存放一个小缓冲
+		bool huge = UseHugePages && capacity >= HugePageSize;
+		if (huge)
+		{
+			address = mmap(nullptr, capacity, PROT_READ | PROT_WRITE,
+				  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		}
+		if (address == MAP_FAILED)
+		{
+			address = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (address == MAP_FAILED)
+			{
+				throw std::runtime_error("[FramePool::MapBuffer] Failed to Map Frame Buffer.");
+			}
+			// 未预留大页时，建议内核使用透明大页，须在首次访问前设置
+			if (huge)
+			{
+				madvise(address, capacity, MADV_HUGEPAGE);
+			}
+		}
+
+		// 预先缺页，使得首次使用缓冲时不再发生缺页
+		std::memset(address, 0, capacity);
+
+		Mappings.emplace_back(address, capacity);
+		MappedBytes += capacity;
+		return address;
+	}
+
+	/// 取用缓冲
+	void* FramePool::TakeBuffer(std::size_t bytes) const
+	{
+		auto capacity = GetBucketCapacity(bytes);
+
+		std::unique_lock lock(Mutex);
+		auto& bucket = FreeBuffers[capacity];
+		if (bucket.empty())
+		{
+			// 预先为归还留出空间，使得归还时不再分配
+			bucket.reserve(bucket.capacity() + 1);
+			return MapBuffer(capacity);
+		}
+		auto* buffer = bucket.back();
+		bucket.pop_back();
+		return buffer;
+	}
+
+	/// 归还缓冲
+	void FramePool::ReturnBuffer(void *buffer, std::size_t bytes) const
+	{
+		auto capacity = GetBucketCapacity(bytes);
+
+		std::unique_lock lock(Mutex);
+		FreeBuffers[capacity].push_back(buffer);
+	}
+
+	/// 预留缓冲
+	void FramePool::Reserve(cv::Size size, int type, std::size_t count)
+	{
+		auto capacity = GetBucketCapacity(size.area() * CV_ELEM_SIZE(type));
+
+		std::unique_lock lock(Mutex);
+		auto& bucket = FreeBuffers[capacity];
+		bucket.reserve(count);
+		while (bucket.size() < count)
+		{
+			bucket.push_back(MapBuffer(capacity));
+		}
+	}
+
+	/// 取用图像
+	cv::Mat FramePool::Acquire(cv::Size size, int type)
+	{
+		cv::Mat picture;
+		picture.allocator = this;
+		picture.create(size, type);
+		return picture;
+	}
+
+	/// 将图像绑定到该缓冲池
+	void FramePool::Bind(cv::Mat &picture)
+	{
+		picture.release();
+		picture.allocator = this;
+	}
+
+	/// 获取映射过的总字节数
+	std::size_t FramePool::GetMappedBytes() const
+	{
+		std::unique_lock lock(Mutex);
+		return MappedBytes;
+	}
+
+	/// 分配图像数据
+	cv::UMatData* FramePool::allocate(int dims, const int *sizes, int type, void *data, size_t *step,
+								cv::AccessFlag flags, cv::UMatUsageFlags usage_flags) const
+	{
+		// 步长的计算方式与OpenCV的默认分配器相同
+		std::size_t total = CV_ELEM_SIZE(type);
+		for (int index = dims - 1; index >= 0; --index)
+		{
+			if (step)
+			{
+				if (data && step[index] != cv::Mat::AUTO_STEP)
+				{
+					total = step[index];
+				}
+				else
+				{
+					step[index] = total;
+				}
+			}
+			total *= sizes[index];
+		}
+
+		auto* mat_data = new cv::UMatData(this);
+		mat_data->size = total;
+		if (data)
+		{
+			mat_data->data = mat_data->origdata = static_cast<uchar*>(data);
+			mat_data->flags |= cv::UMatData::USER_ALLOCATED;
+		}
+		else
+		{
+			mat_data->data = mat_data->origdata = static_cast<uchar*>(TakeBuffer(total));
+		}
+		return mat_data;
+	}
+
+	/// 为已有的图像数据分配设备内存
+	bool FramePool::allocate(cv::UMatData *data, cv::AccessFlag access_flags, cv::UMatUsageFlags usage_flags) const
+	{
+		return data != nullptr;
+	}
+
+	/// 释放图像数据
+	void FramePool::deallocate(cv::UMatData *data) const
+	{
+		if (!data)
+		{
+			return;
+		}
+		if (!(data->flags & cv::UMatData::USER_ALLOCATED) && data->origdata)
+		{
+			ReturnBuffer(data->origdata, data->size);
+			data->origdata = nullptr;
+		}
+		delete data;
+	}
+}
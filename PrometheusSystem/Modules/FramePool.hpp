@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <tuple>
+#include <unordered_map>
+#include <opencv4/opencv2/opencv.hpp>
+
+namespace RoboPioneers::Modules
+{
+	/**
+	 * @brief 帧缓冲池
+	 * @author Vincent
+	 * @details
+	 *  ~ 该类作为cv::Mat的内存分配器，按容量分桶回收图像缓冲，被释放的缓冲将归还到对应的桶中，而非归还给操作系统。
+	 *  ~ 桶的容量为不小于所需字节数的2的幂，故裁剪区域等引起的尺寸变化只要不超出桶的容量，就不会申请新的内存。
+	 *  ~ 缓冲以匿名映射申请，并在申请时预先缺页；稳态下取用和归还缓冲只涉及加锁和空闲列表的操作，不会发生映射、解除映射或缺页。
+	 *  ~ 所有取用和归还操作都是线程安全的；缓冲池的生命周期须长于由其分配的所有图像。
+	 */
+	class FramePool : public cv::MatAllocator
+	{
+	private:
+		/// 互斥量，保护空闲列表和映射列表
+		mutable std::mutex Mutex {};
+		/// 各桶的空闲缓冲列表，键为桶的容量
+		mutable std::unordered_map<std::size_t, std::vector<void*>> FreeBuffers {};
+		/// 所有映射过的缓冲及其映射长度，用于析构时解除映射
+		mutable std::vector<std::tuple<void*, std::size_t>> Mappings {};
+		/// 映射过的总字节数
+		mutable std::size_t MappedBytes {0};
+
+		/**
+		 * @brief 获取字节数对应的桶容量
+		 * @param bytes 所需字节数
+		 * @return 不小于所需字节数和页大小的2的幂
+		 */
+		static std::size_t GetBucketCapacity(std::size_t bytes);
+
+		/**
+		 * @brief 映射新的缓冲
+		 * @param capacity 桶容量
+		 * @return 缓冲地址
+		 * @throw std::runtime_error 当内存不足时抛出该异常
+		 * @details
+		 *  ~ 调用时须已持有互斥量。
+		 */
+		void* MapBuffer(std::size_t capacity) const;
+
+		/**
+		 * @brief 取用缓冲
+		 * @param bytes 所需字节数
+		 * @return 容量不小于所需字节数的缓冲地址
+		 * @details
+		 *  ~ 对应的桶为空时，将映射新的缓冲。
+		 */
+		void* TakeBuffer(std::size_t bytes) const;
+
+		/**
+		 * @brief 归还缓冲
+		 * @param buffer 缓冲地址
+		 * @param bytes 取用时的所需字节数
+		 */
+		void ReturnBuffer(void* buffer, std::size_t bytes) const;
+
+	public:
+		/**
+		 * @brief 是否使用大页
+		 * @details
+		 *  ~ 启用后新的缓冲将优先使用预留的大页映射，系统未预留大页时将回退为普通页，并建议内核使用透明大页。
+		 *  ~ 应当在预留缓冲之前设置，已经映射的缓冲不受影响。
+		 */
+		bool UseHugePages {false};
+
+		/// 默认构造函数
+		FramePool() = default;
+		/// 禁止拷贝构造
+		FramePool(const FramePool&) = delete;
+		/// 析构函数，将解除所有缓冲的映射
+		~FramePool() override;
+
+		/**
+		 * @brief 获取全局帧缓冲池
+		 * @return 全局帧缓冲池的指针
+		 */
+		static FramePool* GetInstance();
+
+		/**
+		 * @brief 预留缓冲
+		 * @param size 图像尺寸
+		 * @param type 图像类型，例如CV_8UC1
+		 * @param count 预留的缓冲数量
+		 * @details
+		 *  ~ 将该尺寸对应的桶补足至至少count个空闲缓冲，通常在启动时调用，使得运行期间不再需要映射新的缓冲。
+		 */
+		void Reserve(cv::Size size, int type, std::size_t count);
+
+		/**
+		 * @brief 取用图像
+		 * @param size 图像尺寸
+		 * @param type 图像类型
+		 * @return 由该缓冲池分配的图像，内容未初始化
+		 * @details
+		 *  ~ 图像的引用计数归零时，其缓冲将自动归还到缓冲池。
+		 */
+		cv::Mat Acquire(cv::Size size, int type);
+
+		/**
+		 * @brief 将图像绑定到该缓冲池
+		 * @param picture 图像
+		 * @details
+		 *  ~ 图像当前持有的数据将被释放，之后OpenCV函数为其输出创建数据时将从该缓冲池取用缓冲。
+		 *  ~ 将其他图像赋值给该图像时，绑定将被替换为来源图像的分配器。
+		 */
+		void Bind(cv::Mat& picture);
+
+		/**
+		 * @brief 获取映射过的总字节数
+		 * @return 映射过的总字节数，稳态下该值不再增长
+		 */
+		[[nodiscard]] std::size_t GetMappedBytes() const;
+
+		//==============================
+		// 分配器接口部分
+		//==============================
+
+		/// 分配图像数据
+		cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+						 cv::AccessFlag flags, cv::UMatUsageFlags usage_flags) const override;
+
+		/// 为已有的图像数据分配设备内存，图像数据始终位于主存中，故无需操作
+		bool allocate(cv::UMatData* data, cv::AccessFlag access_flags, cv::UMatUsageFlags usage_flags) const override;
+
+		/// 释放图像数据，缓冲将归还到缓冲池
+		void deallocate(cv::UMatData* data) const override;
+	};
+}
@@ -0,0 +1,55 @@
+#include "LightBarSet.hpp"
+
+#include "GeometryFeatureModule.hpp"
+
+namespace RoboPioneers::Modules
+{
+	/// 构造函数
+	LightBarSet::LightBarSet(std::pmr::memory_resource *resource) :
+		Centers(resource), Sizes(resource), Angles(resource),
+		FeatureAngles(resource), FeatureLengths(resource), FeatureWidths(resource),
+		FeatureCentersX(resource), FeatureCentersY(resource)
+	{}
+
+	/// 预留空间
+	void LightBarSet::Reserve(std::size_t count)
+	{
+		Centers.reserve(count);
+		Sizes.reserve(count);
+		Angles.reserve(count);
+		FeatureAngles.reserve(count);
+		FeatureLengths.reserve(count);
+		FeatureWidths.reserve(count);
+		FeatureCentersX.reserve(count);
+		FeatureCentersY.reserve(count);
+	}
+
+	/// 清空集合
+	void LightBarSet::Clear()
+	{
+		Centers.clear();
+		Sizes.clear();
+		Angles.clear();
+		FeatureAngles.clear();
+		FeatureLengths.clear();
+		FeatureWidths.clear();
+		FeatureCentersX.clear();
+		FeatureCentersY.clear();
+	}
+
+	/// 添加灯条
+	void LightBarSet::Add(const cv::RotatedRect &rotated_rectangle)
+	{
+		auto feature = GeometryFeatureModule::StandardizeRotatedRectangle(rotated_rectangle);
+
+		Centers.push_back(rotated_rectangle.center);
+		Sizes.push_back(rotated_rectangle.size);
+		Angles.push_back(rotated_rectangle.angle);
+
+		FeatureAngles.push_back(static_cast<float>(feature.Angle));
+		FeatureLengths.push_back(static_cast<float>(feature.Length));
+		FeatureWidths.push_back(static_cast<float>(feature.Width));
+		FeatureCentersX.push_back(static_cast<float>(feature.Center.x));
+		FeatureCentersY.push_back(static_cast<float>(feature.Center.y));
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+#include <opencv4/opencv2/opencv.hpp>
+
+namespace RoboPioneers::Modules
+{
+	/**
+	 * @brief 灯条集合
+	 * @author Vincent
+	 * @details
+	 *  ~ 以结构数组的形式连续存放灯条：每项属性各占一个数组，同一下标对应同一个灯条。
+	 *  ~ 除原始旋转矩形外，还存放添加时计算好的标准化几何特征，匹配时不需要重复标准化，且同一属性的数据在内存中相邻，便于向量化。
+	 *  ~ 使用多态分配器，可以作为帧通道的值。
+	 */
+	class LightBarSet
+	{
+	public:
+		//==============================
+		// 原始旋转矩形部分
+		//==============================
+
+		/// 中心点
+		std::pmr::vector<cv::Point2f> Centers;
+		/// 尺寸
+		std::pmr::vector<cv::Size2f> Sizes;
+		/// 旋转角度
+		std::pmr::vector<float> Angles;
+
+		//==============================
+		// 标准化几何特征部分
+		// 定义参见GeometryFeatureModule::GeometryFeature
+		//==============================
+
+		/// 标准化转角，范围为[0,180)
+		std::pmr::vector<float> FeatureAngles;
+		/// 长度，即长边的长度
+		std::pmr::vector<float> FeatureLengths;
+		/// 宽度，即短边的长度
+		std::pmr::vector<float> FeatureWidths;
+		/// 取整后的中心横坐标
+		std::pmr::vector<float> FeatureCentersX;
+		/// 取整后的中心纵坐标
+		std::pmr::vector<float> FeatureCentersY;
+
+		/**
+		 * @brief 构造函数
+		 * @param resource 内存资源
+		 */
+		explicit LightBarSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+		/**
+		 * @brief 获取灯条数量
+		 * @return 灯条数量
+		 */
+		[[nodiscard]] std::size_t GetCount() const
+		{
+			return Centers.size();
+		}
+
+		/**
+		 * @brief 查询是否为空
+		 * @retval true 没有灯条
+		 * @retval false 至少有一个灯条
+		 */
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return Centers.empty();
+		}
+
+		/**
+		 * @brief 预留空间
+		 * @param count 灯条数量
+		 */
+		void Reserve(std::size_t count);
+
+		/// 清空集合
+		void Clear();
+
+		/**
+		 * @brief 添加灯条
+		 * @param rotated_rectangle 灯条的外接旋转矩形
+		 * @details
+		 *  ~ 将同时计算并存放其标准化几何特征。
+		 */
+		void Add(const cv::RotatedRect& rotated_rectangle);
+
+		/**
+		 * @brief 获取灯条的旋转矩形
+		 * @param index 灯条的下标
+		 * @return 灯条的外接旋转矩形
+		 */
+		[[nodiscard]] cv::RotatedRect GetRectangle(std::size_t index) const
+		{
+			return cv::RotatedRect(Centers[index], Sizes[index], Angles[index]);
+		}
+	};
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <opencv4/opencv2/opencv.hpp>
+
+#include "FramePool.hpp"
+
+namespace RoboPioneers::Modules
+{
+	/**
+	 * @brief 池化通道模板类
+	 * @tparam ValueType 值类型，目前只支持cv::Mat
+	 */
+	template<typename ValueType>
+	class PooledChannel;
+
+	/**
+	 * @brief 池化图像通道
+	 * @author Vincent
+	 * @details
+	 *  ~ 通道中的图像绑定到帧缓冲池，OpenCV函数向其输出时将从缓冲池取用缓冲，例如下载、颜色转换和阈值处理。
+	 *  ~ 端口仍以cv::Mat通道的方式访问该通道，流处理器不需要做任何修改。
+	 *  ~ 帧结束时应当释放通道中的图像，例如使用PictureRecycler流处理器，使缓冲归还到缓冲池，供其他帧或其他尺寸相近的图像使用。
+	 *  ~ 将不由缓冲池分配的图像赋值给通道后，绑定将失效，直至下一次释放。
+	 */
+	template<>
+	class PooledChannel<cv::Mat> : public Galaxy::Channel<cv::Mat>
+	{
+	private:
+		/// 帧缓冲池
+		FramePool* Pool;
+
+	public:
+		/**
+		 * @brief 多名称构造函数
+		 * @param host 宿主工作流
+		 * @param pool 帧缓冲池
+		 * @param arguments 名称列表
+		 */
+		template<typename WorkflowType, typename... ArgumentsType>
+		PooledChannel(WorkflowType* host, FramePool* pool, ArgumentsType... arguments) :
+			Galaxy::Channel<cv::Mat>(host, arguments...), Pool(pool)
+		{
+			Pool->Bind(Acquire());
+		}
+
+		/**
+		 * @brief 释放图像
+		 * @details
+		 *  ~ 图像的缓冲将在不再被引用时归还到缓冲池，通道将重新绑定到缓冲池。
+		 */
+		void Recycle()
+		{
+			Pool->Bind(Acquire());
+		}
+
+		/**
+		 * @brief 获取帧缓冲池
+		 * @return 帧缓冲池的指针
+		 */
+		[[nodiscard]] FramePool* GetPool() const
+		{
+			return Pool;
+		}
+	};
+}
@@ -1,31 +1,33 @@
 #include "ArmorMatcher.hpp"
-#include "../../Modules/GeometryFeatureModule.hpp"
+
+#include <algorithm>
+#include <cmath>
 
 namespace RoboPioneers::Prometheus::Processors
 {
 	void ArmorMatcher::Execute()
 	{
-		auto& light_bars = *LightBars;
+		const auto& light_bars = *LightBars;
 		auto& armors = *Armors;
-		armors.clear();
-
-		for (auto first_index = light_bars.begin(); first_index != light_bars.end(); ++first_index)
-		{
-			auto second_index = first_index;
-			++second_index;
+		armors.Clear();
 
-			auto first_geometry_feature = Modules::GeometryFeatureModule::StandardizeRotatedRectangle(*first_index);
+		// 标准化特征已在添加灯条时计算，此处只顺序读取连续的数组
+		const auto count = light_bars.GetCount();
+		const auto* angles = light_bars.FeatureAngles.data();
+		const auto* lengths = light_bars.FeatureLengths.data();
+		const auto* widths = light_bars.FeatureWidths.data();
+		const auto* centers_x = light_bars.FeatureCentersX.data();
+		const auto* centers_y = light_bars.FeatureCentersY.data();
 
-			for (; second_index != light_bars.end(); ++second_index)
+		for (std::size_t first_index = 0; first_index < count; ++first_index)
+		{
+			for (std::size_t second_index = first_index + 1; second_index < count; ++second_index)
 			{
-				auto second_geometry_feature = Modules::GeometryFeatureModule::StandardizeRotatedRectangle(*second_index);
-
 				//------------------------------
 				// 角度之差
 				//------------------------------
 
-				auto angle_difference = first_geometry_feature.Angle - second_geometry_feature.Angle;
-				if (angle_difference < 0) angle_difference = -angle_difference;
+				auto angle_difference = std::abs(angles[first_index] - angles[second_index]);
 
 				if (angle_difference > MaxAngleDifference) continue;
 
@@ -33,11 +35,10 @@ namespace RoboPioneers::Prometheus::Processors
 				// Y坐标差值-高度比
 				//------------------------------
 
-				auto height = first_geometry_feature.Length > second_geometry_feature.Length ?
-				              first_geometry_feature.Length : second_geometry_feature.Length;
+				auto height = std::max(lengths[first_index], lengths[second_index]);
 
-				auto delta_y = first_geometry_feature.Center.y - second_geometry_feature.Center.y;
-				if (delta_y < 0) delta_y = -delta_y;
+				auto delta_x = centers_x[first_index] - centers_x[second_index];
+				auto delta_y = std::abs(centers_y[first_index] - centers_y[second_index]);
 
 				auto delta_y_height_ratio = delta_y / height * 100;
 				if (delta_y_height_ratio > MaxDeltaYHeightRatio || delta_y_height_ratio < MinDeltaYHeightRatio)
@@ -47,7 +48,7 @@ namespace RoboPioneers::Prometheus::Processors
 				// 高度-距离比
 				//------------------------------
 
-				auto distance = cv::norm(first_geometry_feature.Center - second_geometry_feature.Center);
+				auto distance = std::sqrt(delta_x * delta_x + delta_y * delta_y);
 
 				auto height_distance_ratio = height / distance * 100;
 				auto big_armor_hd_matched = height_distance_ratio <= MaxHeightDistanceRatioBigArmor && height_distance_ratio >= MinHeightDistanceRatioBigArmor;
@@ -59,15 +60,14 @@ namespace RoboPioneers::Prometheus::Processors
 				// 宽度-距离比
 				//------------------------------
 
-				auto width = first_geometry_feature.Width > second_geometry_feature.Width ?
-				             first_geometry_feature.Width : second_geometry_feature.Width;
+				auto width = std::max(widths[first_index], widths[second_index]);
 				auto width_distance_ratio = width / distance * 100;
 				auto big_armor_wd_matched = width_distance_ratio < MaxWidthDistanceRatioBigArmor && width_distance_ratio > MinWidthDistanceRatioBigArmor;
 				auto small_armor_wd_matched = width_distance_ratio < MaxWidthDistanceRatioSmallArmor && width_distance_ratio > MinWidthDistanceRatioSmallArmor;
 
 				if (!big_armor_wd_matched && !small_armor_wd_matched) continue;
 
-				armors.emplace_back(*first_index, *second_index);
+				armors.Add(first_index, second_index);
 			}
 		}
 	}
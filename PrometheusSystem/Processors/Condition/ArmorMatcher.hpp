@@ -3,8 +3,9 @@
 #include <GalaxyEngine/GalaxyEngine.hpp>
 #include <opencv4/opencv2/opencv.hpp>
 #include <vector>
-#include <list>
-#include <tuple>
+
+#include "../../Modules/LightBarSet.hpp"
+#include "../../Modules/ArmorCandidateSet.hpp"
 
 namespace RoboPioneers::Prometheus::Processors
 {
@@ -17,13 +18,11 @@ namespace RoboPioneers::Prometheus::Processors
 	class ArmorMatcher AsProcessor
 	{
 	Requirement:
-		/// 需要可能的灯条列表
-		Require(std::list<cv::RotatedRect>, LightBars);
-
-		using RotatedRectPair = std::tuple<cv::RotatedRect, cv::RotatedRect>;
+		/// 需要可能的灯条集合
+		RequireReadOnly(Modules::LightBarSet, LightBars);
 
-		/// 可能的装甲板列表
-		Require(std::list<RotatedRectPair>, Armors);
+		/// 可能的装甲板集合
+		Require(Modules::ArmorCandidateSet, Armors);
 
 	public:
 		/// 最大转角偏差值
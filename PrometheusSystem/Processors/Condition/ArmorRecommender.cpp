@@ -1,8 +1,7 @@
 #include "ArmorRecommender.hpp"
 
-#include "../../Modules/GeometryFeatureModule.hpp"
-
-#include <vector>
+#include <array>
+#include <algorithm>
 
 namespace RoboPioneers::Prometheus::Processors
 {
@@ -11,10 +10,13 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 		Command = 0;
 
-		RotatedRectPair* best_one = nullptr;
+		const auto& light_bars = *LightBars;
+		const auto& armors = *Armors;
+
+		std::size_t best_one = 0;
 		long best_score = -1;
 
-		if (Armors.Acquire().empty())
+		if (armors.IsEmpty())
 		{
 			// 若没找到，根据丢失技术判断是否维持裁剪区域
 			Command = 0;
@@ -43,15 +45,21 @@ namespace RoboPioneers::Prometheus::Processors
 		}
 		else
 		{
-			for (auto& pair : *Armors)
+			for (std::size_t index = 0; index < armors.GetCount(); ++index)
 			{
-				auto first_light = Modules::GeometryFeatureModule::StandardizeRotatedRectangle(std::get<0>(pair));
-				auto second_light = Modules::GeometryFeatureModule::StandardizeRotatedRectangle(std::get<1>(pair));
+				auto first_index = armors.FirstIndices[index];
+				auto second_index = armors.SecondIndices[index];
+
+				// 使用灯条集合中预先计算的标准化特征，不再重复标准化
+				cv::Point2i first_center(static_cast<int>(light_bars.FeatureCentersX[first_index]),
+										 static_cast<int>(light_bars.FeatureCentersY[first_index]));
+				cv::Point2i second_center(static_cast<int>(light_bars.FeatureCentersX[second_index]),
+										  static_cast<int>(light_bars.FeatureCentersY[second_index]));
 
-				auto length = cv::norm(first_light.Center - second_light.Center);
-				auto width = first_light.Length > second_light.Length ? first_light.Length : second_light.Length;
+				auto length = cv::norm(first_center - second_center);
+				auto width = std::max(light_bars.FeatureLengths[first_index], light_bars.FeatureLengths[second_index]);
 
-				auto center_point = (first_light.Center + second_light.Center) / 2;
+				auto center_point = (first_center + second_center) / 2;
 
 				auto real_center_point = center_point + *PositionOffset;
 
@@ -61,21 +69,21 @@ namespace RoboPioneers::Prometheus::Processors
 
 				if (score > best_score)
 				{
-					best_one = &pair;
+					best_one = index;
 					best_score = score;
 				}
 			}
 
-			auto& first_light = std::get<0>(*best_one);
-			auto& second_light = std::get<1>(*best_one);
+			auto first_light = light_bars.GetRectangle(armors.FirstIndices[best_one]);
+			auto second_light = light_bars.GetRectangle(armors.SecondIndices[best_one]);
 
 			auto center_point = (first_light.center + second_light.center) / 2;
 
-			std::vector<cv::Point2f> armor_vertices;
-			armor_vertices.resize(8);
+			std::array<cv::Point2f, 8> armor_vertices;
 			first_light.points(&armor_vertices[0]);
 			second_light.points(&armor_vertices[4]);
-			auto armor_rectangle = cv::minAreaRect(armor_vertices).boundingRect();
+			auto armor_rectangle = cv::minAreaRect(
+				cv::_InputArray(armor_vertices.data(), static_cast<int>(armor_vertices.size()))).boundingRect();
 
 			auto& cutting_area = *CuttingArea;
 			auto& global_offset = *PositionOffset;
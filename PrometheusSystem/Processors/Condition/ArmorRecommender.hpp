@@ -3,6 +3,9 @@
 #include <GalaxyEngine/GalaxyEngine.hpp>
 #include <opencv4/opencv2/opencv.hpp>
 
+#include "../../Modules/LightBarSet.hpp"
+#include "../../Modules/ArmorCandidateSet.hpp"
+
 namespace RoboPioneers::Prometheus::Processors
 {
 	/**
@@ -14,15 +17,15 @@ namespace RoboPioneers::Prometheus::Processors
 	class ArmorRecommender AsProcessor
 	{
 	Requirement:
-		using RotatedRectPair = std::tuple<cv::RotatedRect, cv::RotatedRect>;
-
 		/// 裁剪偏移量
-		Require(cv::Point, PositionOffset);
-		/// 可能的装甲板列表
-		Require(std::list<RotatedRectPair>, Armors);
+		RequireReadOnly(cv::Point, PositionOffset);
+		/// 灯条集合
+		RequireReadOnly(Modules::LightBarSet, LightBars);
+		/// 可能的装甲板集合，引用灯条集合中的下标
+		RequireReadOnly(Modules::ArmorCandidateSet, Armors);
 
 		/// 裁剪目标区域
-		Require(cv::Rect, CuttingArea);
+		RequireReadOnly(cv::Rect, CuttingArea);
 		/// 指令位
 		Require(char, Command);
 		/// 横坐标
@@ -1,7 +1,5 @@
 #include "LightBarsFilter.hpp"
 
-#include "../../Modules/GeometryFeatureModule.hpp"
-
 namespace RoboPioneers::Prometheus::Processors
 {
 	/// 执行方法
@@ -9,7 +7,8 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 		auto& contours = *Contours;
 		auto& light_bars = *LightBars;
-		light_bars.clear();
+		light_bars.Clear();
+		light_bars.Reserve(contours.size());
 
 		for (auto& contour : contours)
 		{
@@ -23,7 +22,7 @@ namespace RoboPioneers::Prometheus::Processors
 
 			if (area / rotated_rectangle.size.area() * 100 < MinFillingRatio) continue;
 
-			light_bars.push_back(rotated_rectangle);
+			light_bars.Add(rotated_rectangle);
 		}
 
 	}
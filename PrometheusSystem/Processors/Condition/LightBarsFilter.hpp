@@ -4,8 +4,9 @@
 #include <opencv4/opencv2/opencv.hpp>
 
 #include <vector>
-#include <list>
-#include <tuple>
+
+#include "../../Modules/FrameContainers.hpp"
+#include "../../Modules/LightBarSet.hpp"
 
 namespace RoboPioneers::Prometheus::Processors
 {
@@ -19,9 +20,9 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 	Requirement:
 		/// 轮廓集合
-		Require(std::vector<std::vector<cv::Point>>, Contours);
-		/// 灯条列表
-		Require(std::list<cv::RotatedRect>, LightBars);
+		RequireReadOnly(Modules::ContourList, Contours);
+		/// 灯条集合
+		Require(Modules::LightBarSet, LightBars);
 
 	public:
 		/**
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <GalaxyEngine/GalaxyEngine.hpp>
+
+namespace RoboPioneers::Prometheus::Processors
+{
+	/**
+	 * @brief 目标丢失分支
+	 * @author Vincent
+	 * @details
+	 *  ~ 该流处理器用于在未发现目标时跳过只在发现目标时才有意义的流处理器。
+	 *  ~ 该流处理器将读取char类型的Command通道，指令不为1时跳转至目标标签。
+	 */
+	class TargetLostBranch AsProcessor
+	{
+	Requirement:
+		/// 指令
+		RequireReadOnly(char, Command);
+
+	public:
+		/// 跳转目标
+		Galaxy::Core::AbstractProcessor* Target {nullptr};
+
+		/// 构造函数
+		Configure(TargetLostBranch, Galaxy::Core::AbstractProcessor* target), Target(target)
+		{}
+
+		/// 执行方法
+		Process
+		{
+			if (Command.Acquire() != 1)
+			{
+				JumpTo(Target);
+			}
+		}
+	};
+}
@@ -17,7 +17,7 @@ namespace RoboPioneers::Prometheus::Processors::DebugPackage
 	{
 	Requirement:
 		/// 输出图像
-		Require(cv::cuda::GpuMat, GpuPicture);
+		RequireReadOnly(cv::cuda::GpuMat, GpuPicture);
 		/// 输出图像的流
 		RequireOptional(cv::cuda::Stream, GpuStream);
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <opencv4/opencv2/opencv.hpp>
+#include <string>
+#include <utility>
+
+#include "../../Modules/ImageDebugUtility.hpp"
+#include "../../Modules/LightBarSet.hpp"
+
+namespace RoboPioneers::Prometheus::Processors::DebugPackage
+{
+	/**
+	 * @brief 灯条显示流处理器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该流处理器用于在图像上绘制灯条并显示。
+	 *  ~ 该流处理器将读取cv::cuda::GpuMat类型的GpuPicture通道，以及Modules::LightBarSet类型的LightBars通道。
+	 */
+	class LightBarsView AsProcessor
+	{
+	Requirement:
+		/// 显存图像
+		RequireReadOnly(cv::cuda::GpuMat, GpuPicture);
+		/// 灯条集合
+		RequireReadOnly(Modules::LightBarSet, LightBars);
+
+	public:
+		/// 窗口标题
+		std::string Title;
+
+		/// 构造函数
+		Configure(LightBarsView, std::string title = "LightBars"), Title(std::move(title))
+		{}
+
+		/// 执行方法
+		Process
+		{
+			cv::Mat picture;
+			cv::cuda::Stream stream;
+			GpuPicture.Acquire().download(picture, stream);
+			stream.waitForCompletion();
+			const auto& light_bars = LightBars.Acquire();
+			for (std::size_t index = 0; index < light_bars.GetCount(); ++index)
+			{
+				Modules::ImageDebugUtility::DrawRotatedRectangle(picture, light_bars.GetRectangle(index),
+													 cv::Scalar(0,255,0), 3);
+			}
+			cv::imshow(Title, picture);
+		}
+	};
+}
@@ -17,7 +17,7 @@ namespace RoboPioneers::Prometheus::Processors::DebugPackage
 	{
 	Requirement:
 		/// 输出图像
-		Require(cv::Mat, Picture);
+		RequireReadOnly(cv::Mat, Picture);
 
 	public:
 		/// 窗口标题
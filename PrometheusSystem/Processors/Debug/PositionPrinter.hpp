@@ -0,0 +1,35 @@
+#pragma once
+
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <iostream>
+
+namespace RoboPioneers::Prometheus::Processors::DebugPackage
+{
+	/**
+	 * @brief 坐标打印流处理器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该流处理器用于在发现目标时打印目标坐标。
+	 *  ~ 该流处理器将读取char类型的Command通道，以及int类型的X、Y通道。
+	 */
+	class PositionPrinter AsProcessor
+	{
+	Requirement:
+		/// 指令
+		RequireReadOnly(char, Command);
+		/// 横坐标
+		RequireReadOnly(int, X);
+		/// 纵坐标
+		RequireReadOnly(int, Y);
+
+	public:
+		/// 执行方法
+		Process
+		{
+			if (Command.Acquire() == 1)
+			{
+				std::cout << "Found X:" << X.Acquire() << " Y:" << Y.Acquire() << std::endl;
+			}
+		}
+	};
+}
@@ -7,9 +7,8 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 		auto& binary_picture = *BinaryPicture;
 		auto& contours = *Contours;
-		contours.clear();
 
+		// 轮廓直接输出到通道中，OpenCV将按照检测结果调整列表的大小
 		cv::findContours(binary_picture, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
-
 	}
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include <opencv4/opencv2/opencv.hpp>
 #include <vector>
 
+#include "../../Modules/FrameContainers.hpp"
+
 namespace RoboPioneers::Prometheus::Processors
 {
 	/**
@@ -16,9 +18,9 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 	Requirement:
 		/// 用于检测轮廓的二值图
-		Require(cv::Mat, BinaryPicture);
+		RequireReadOnly(cv::Mat, BinaryPicture);
 		/// 轮廓列表
-		Require(std::vector<std::vector<cv::Point>>, Contours);
+		Require(Modules::ContourList, Contours);
 
 	public:
 		/**
@@ -63,7 +63,8 @@ extern "C" void FilterColor(
 		int min_value, int max_value,
 		cv::cuda::GpuMat& source, cv::cuda::GpuMat& target, cv::cuda::Stream& stream)
 {
-	target = cv::cuda::GpuMat(source.size(), CV_8UC1, cv::Scalar(0,0,0));
+	// 尺寸和类型不变时复用上一帧的显存；核函数会写入每个像素，故不需要清零
+	target.create(source.size(), CV_8UC1);
 
 	// 图形宽度
 	const auto width = source.cols;
@@ -22,7 +22,16 @@ namespace RoboPioneers::Prometheus::Processors
 		unsigned int CameraGain = 16;
 		unsigned int WaitingSeconds = 30;
 
-		CameraObjectsManagerScript() = default;
+		/// 新图片就绪条件，所有正在等待的图像获取流处理器将被同时唤醒
+		Galaxy::BuiltIn::ConditionAwaitable PictureReady {[this]{ return Acquisitor.HasNewPicture(); }};
+
+		/// 构造函数，将在新图片到达时唤醒等待新图片的工作流
+		CameraObjectsManagerScript()
+		{
+			Acquisitor.OnPictureIncome = [this]{
+				PictureReady.Notify();
+			};
+		}
 
 		/// 析构函数，将自动关闭设备和采集器
 		~CameraObjectsManagerScript()
@@ -92,11 +101,22 @@ namespace RoboPioneers::Prometheus::Processors
 	/// 执行方法
 	void PictureAcquirer::Execute()
 	{
-		if (!GetManagedCameraObjects()->Acquisitor.IsWorking())
+		auto* manager = GetManagedCameraObjects();
+
+		AwaitBegin;
+		if (!manager->Acquisitor.IsWorking())
 		{
 			OnInitialize();
 		}
-		Picture.Set(GetManagedCameraObjects()->Acquisitor.GetPicture(WaitForLatest));
+		// 等待新图片期间工作流将离开执行器，而非在执行器线程中自旋
+		if (WaitForLatest)
+		{
+			Await(manager->PictureReady);
+		}
+		Picture.Set(manager->Acquisitor.GetPicture(false));
+		// 等待相机的时间不计入帧时间预算
+		StartFrameBudget();
+		AwaitEnd;
 	}
 
 	/// 初始化方法
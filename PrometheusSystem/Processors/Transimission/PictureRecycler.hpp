@@ -0,0 +1,35 @@
+#pragma once
+
+#include <GalaxyEngine/GalaxyEngine.hpp>
+#include <opencv4/opencv2/opencv.hpp>
+
+namespace RoboPioneers::Prometheus::Processors
+{
+	/**
+	 * @brief 图像回收器
+	 * @author Vincent
+	 * @details
+	 *  ~ 该流处理器将释放指定通道中的图像，通常放置在工作流末尾，使池化通道中的缓冲在帧结束时归还到帧缓冲池。
+	 *  ~ 释放后通道的分配器保持不变，故池化通道在下一帧中仍从缓冲池取用缓冲。
+	 *  ~ 第一个配置选项为被释放的图像所在通道。
+	 */
+	class PictureRecycler AsProcessor
+	{
+	Requirement:
+		/// 被释放的图片
+		Require(cv::Mat, Picture);
+
+	public:
+		/// 配置
+		Configure(PictureRecycler, Name(Picture))
+		{
+			ApplyName(Picture);
+		}
+
+		/// 释放图片操作
+		Process
+		{
+			Picture.Acquire().release();
+		}
+	};
+}
@@ -19,13 +19,13 @@ namespace RoboPioneers::Prometheus::Processors
 	{
 	Requirement:
 		/// 指令通道
-		Require(char, Command);
+		RequireReadOnly(char, Command);
 		/// 横坐标
-		Require(int, X);
+		RequireReadOnly(int, X);
 		/// 纵坐标
-		Require(int, Y);
+		RequireReadOnly(int, Y);
 		/// 数字识别
-		Require(char, Number);
+		RequireReadOnly(char, Number);
 
 	public:
 		Modules::SerialPortDriver::SerialPort Port;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <GalaxyEngine/GalaxyEngine.hpp>
+#include <atomic>
 #include <opencv4/opencv2/opencv.hpp>
 
 namespace RoboPioneers::Prometheus::Processors
@@ -10,16 +11,41 @@ namespace RoboPioneers::Prometheus::Processors
 	 * @author Vincent
 	 * @details
 	 *  ~ 该流处理器用于在CPU和GPU间同步。
+	 *  ~ 等待期间工作流将离开执行器，由GPU流的主机回调将其重新提交，而非阻塞执行器线程。
 	 */
 	class WaitGPUStream AsProcessor
 	{
 	Requirement:
 		Require(cv::cuda::Stream, GpuStream);
 
+	private:
+		/**
+		 * @brief 主机回调是否已执行
+		 * @details
+		 *  ~ 回调返回之前CUDA不会认为流已完成，故不能以queryIfComplete作为等待条件，否则先于订阅的通知将丢失。
+		 */
+		std::atomic_bool CallbackInvoked {false};
+
+		/// GPU流完成条件
+		Galaxy::BuiltIn::ConditionAwaitable StreamCompleted {[this]{ return CallbackInvoked.load(); }};
+
+		/// GPU流主机回调，在CUDA的回调线程中执行，不能调用CUDA接口
+		static void NotifyStreamCompleted(int, void* user_data)
+		{
+			auto* processor = static_cast<WaitGPUStream*>(user_data);
+			// 先使条件成立，再通知
+			processor->CallbackInvoked.store(true);
+			processor->StreamCompleted.Notify();
+		}
+
 	public:
 		void Execute() override
 		{
-			(*GpuStream).waitForCompletion();
+			AwaitBegin;
+			CallbackInvoked.store(false);
+			(*GpuStream).enqueueHostCallback(&WaitGPUStream::NotifyStreamCompleted, this);
+			Await(StreamCompleted);
+			AwaitEnd;
 		}
 	};
 }
\ No newline at end of file
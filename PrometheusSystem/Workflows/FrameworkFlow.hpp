@@ -4,6 +4,7 @@
 #include <opencv4/opencv2/opencv.hpp>
 #include <shared_mutex>
 #include <condition_variable>
+#include <chrono>
 
 #include <iostream>
 
@@ -11,12 +12,17 @@
 #include "../Modules/ImageDebugUtility.hpp"
 #endif
 #include "../Modules/GeometryFeatureModule.hpp"
+#include "../Modules/PooledChannel.hpp"
+#include "../Modules/FrameContainers.hpp"
+#include "../Modules/LightBarSet.hpp"
+#include "../Modules/ArmorCandidateSet.hpp"
 
 #include "../Processors/Transimission/PictureAcquirer.hpp"
 #include "../Processors/Transimission/GpuPictureUploader.hpp"
 #include "../Processors/Transimission/GpuPictureDownloader.hpp"
 #include "../Processors/Transimission/SerialCommand.hpp"
 #include "../Processors/Transimission/WaitGPUStream.hpp"
+#include "../Processors/Transimission/PictureRecycler.hpp"
 
 #include "../Processors/Preprocess/PictureCutter.hpp"
 #include "../Processors/Preprocess/BayerBGToHSVConverter.hpp"
@@ -29,9 +35,14 @@
 #include "../Processors/Condition/LightBarsFilter.hpp"
 #include "../Processors/Condition/ArmorMatcher.hpp"
 #include "../Processors/Condition/ArmorRecommender.hpp"
+#include "../Processors/Condition/TargetLostBranch.hpp"
 
 #include "../Processors/Debug/MatView.hpp"
 #include "../Processors/Debug/GpuMatView.hpp"
+#include "../Processors/Debug/PositionPrinter.hpp"
+#ifdef DEBUG
+#include "../Processors/Debug/LightBarsView.hpp"
+#endif
 
 namespace RoboPioneers::Prometheus
 {
@@ -40,6 +51,7 @@ namespace RoboPioneers::Prometheus
 	 * @author Vincent
 	 * @details
 	 *  ~ 该工作流对应一帧。
+	 *  ~ 流处理器只通过端口访问通道，从而可以被帧流水线挂载到其他同类型工作流的通道组上。
 	 */
 	class FrameworkFlow AsWorkflow
 	{
@@ -70,15 +82,15 @@ namespace RoboPioneers::Prometheus
 
 		/// 二值GPU图片通道
 		Galaxy::Channel<cv::cuda::GpuMat> GpuBinaryPicture Provide("GpuBinaryPicture");
-		/// 二值图片通道
-		Galaxy::Channel<cv::Mat> BinaryPicture Provide("BinaryPicture");
+		/// 二值图片通道，裁剪区域随帧变化，故从帧缓冲池取用缓冲
+		Modules::PooledChannel<cv::Mat> BinaryPicture Provide(Modules::FramePool::GetInstance(), "BinaryPicture");
 
-		/// 轮廓列表
-		Galaxy::Channel<std::vector<std::vector<cv::Point2i>>> Contours Provide("Contours", {});
-		/// 灯条列表
-		Galaxy::Channel<std::list<cv::RotatedRect>> LightBars Provide("LightBars", {});
-		/// 装甲板列表
-		Galaxy::Channel<std::list<std::tuple<cv::RotatedRect, cv::RotatedRect>>> Armors Provide("Armors", {});
+		/// 轮廓列表，由轮廓检测器直接覆盖，在各帧之间复用
+		Galaxy::Channel<Modules::ContourList> Contours Provide("Contours");
+		/// 灯条集合，每帧开始时清空，内存来自帧内存区
+		Galaxy::FrameChannel<Modules::LightBarSet> LightBars Provide("LightBars");
+		/// 装甲板候选集合，引用灯条集合中的下标，每帧开始时清空，内存来自帧内存区
+		Galaxy::FrameChannel<Modules::ArmorCandidateSet> Armors Provide("Armors");
 
 		/// 指令通道
 		Galaxy::Channel<char> Command Provide("Command");
@@ -127,20 +139,8 @@ namespace RoboPioneers::Prometheus
 
 		#ifdef DEBUG
 
-		Galaxy::BuiltIn::LambdaAction DrawLightBars On(MainCore, [
-				channel_gpu_picture = &this->GpuPicture,
-				channel_light_bars = &this->LightBars]{
-			cv::Mat picture;
-			cv::cuda::Stream stream;
-			channel_gpu_picture->Acquire().download(picture, stream);
-			stream.waitForCompletion();
-			for (auto& light_bar : channel_light_bars->Acquire())
-			{
-				Modules::ImageDebugUtility::DrawRotatedRectangle(picture, light_bar,
-													 cv::Scalar(0,255,0), 3);
-			}
-			cv::imshow("LightBars", picture);
-		});
+		/// 灯条显示
+		Processors::DebugPackage::LightBarsView DrawLightBars On(MainCore);
 
 		#endif
 
@@ -149,20 +149,33 @@ namespace RoboPioneers::Prometheus
 		/// 装甲板推荐
 		Processors::ArmorRecommender RecommendArmor On(MainCore);
 
-		Galaxy::BuiltIn::LambdaAction PrintPosition On(MainCore, [
-				channel_command = &this->Command,
-				channel_x = &this->X,
-				channel_y = &this->Y]{
-			if (channel_command->Acquire() == 1)
-			{
-				std::cout << "Found X:" << channel_x->Acquire() << " Y:" << channel_y->Acquire() << std::endl;
-			}
-		});
+		/// 未发现目标时跳过坐标打印，但指令仍需发送，以便下位机得知目标丢失
+		Processors::TargetLostBranch SkipWhenTargetLost On(MainCore, &TargetHandled);
+
+		/// 坐标打印
+		Processors::DebugPackage::PositionPrinter PrintPosition On(MainCore);
+
+		/// 目标处理完毕
+		Galaxy::BuiltIn::Label TargetHandled {this};
 
 		#ifndef DEBUG
 		Processors::SerialCommand SendSerialCommand On(MultiCores, "/dev/ttyTHS2");
 		#endif
 
+		/// 帧结束，将二值图的缓冲归还到帧缓冲池
+		Processors::PictureRecycler RecycleBinaryPicture On(MainCore, "BinaryPicture");
+
 		Galaxy::BuiltIn::LambdaAction ThirdStageEndNotifier On(MainCore,[]{});
+
+	public:
+		/// 构造函数
+		FrameworkFlow()
+		{
+			// 超过预算的帧计算出的指令已经过时，发送过时的指令不如不发送
+			FrameBudget = std::chrono::milliseconds(DefaultFrameBudgetMilliseconds);
+		}
+
+		/// 默认的帧时间预算，单位为毫秒，从取得图片时开始计算
+		static constexpr int DefaultFrameBudgetMilliseconds = 50;
 	};
 }
\ No newline at end of file
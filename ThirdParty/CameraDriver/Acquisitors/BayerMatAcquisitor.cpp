@@ -14,17 +14,23 @@ namespace RoboPioneers::Modules::CameraDriver::Acquisitors
 			Working = true;
 		}
 
-		// 更新最新图片状态
-		if (!IsPictureLatest.load())
-		{
-			IsPictureLatest = true;
-		}
-
 		auto&& picture = ConvertRawDataToPicture(data);
 
 		std::unique_lock lock(PictureMutex);
 
 		Picture = std::move(picture);
+		lock.unlock();
+
+		// 图片存储完毕后再更新最新图片状态，使得查询到新图片时一定能够获取到它
+		if (!IsPictureLatest.load())
+		{
+			IsPictureLatest = true;
+		}
+
+		if (OnPictureIncome)
+		{
+			OnPictureIncome();
+		}
 	}
 
 	/// 获取新采集的图片
@@ -2,6 +2,7 @@
 
 #include <shared_mutex>
 #include <atomic>
+#include <functional>
 #include <opencv4/opencv2/opencv.hpp>
 
 #include "AbstractAcquisitor.hpp"
@@ -24,6 +25,15 @@ namespace RoboPioneers::Modules::CameraDriver::Acquisitors
 		/// 图片对象，格式CV_8UC1
 		cv::Mat Picture {};
 
+	public:
+		/**
+		 * @brief 新图片到达事件
+		 * @details
+		 *  ~ 新图片存储完毕后，将在采集线程中调用，此时HasNewPicture已经返回true。
+		 *  ~ 应当在开始采集前设置，且不应在其中进行耗时的操作。
+		 */
+		std::function<void()> OnPictureIncome {};
+
 	protected:
 		/**
 		 * @brief 将原始图像转换为Mat矩阵